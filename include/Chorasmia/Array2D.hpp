@@ -7,12 +7,26 @@
 //****************************************************************************
 #pragma once
 #include "MutableArrayView2D.hpp"
+#include <concepts>
+#include <memory>
+#include <utility>
 #include <string>
 
 #include "Extent2D.hpp"
+#include "MdspanInterop.hpp"
 
 namespace Chorasmia
 {
+    template <typename Func, typename... Operands>
+    class ArrayExpression;
+
+    /**
+     * @brief A 2D array of values stored row by row.
+     *
+     * The values are normally stored in a std::vector owned by the
+     * array, but an array can also adopt an external buffer, e.g.
+     * memory returned by malloc or mmap, without copying it.
+     */
     template <typename T>
     class Array2D
     {
@@ -24,16 +38,19 @@ namespace Chorasmia
 
         explicit Array2D(Size2D<size_t> size)
             : buffer_(size.rows * size.columns),
+              data_(buffer_.data()),
               size_(size)
         {}
 
         Array2D(const T* values, Size2D<size_t> size)
             : buffer_(values, values + size.rows * size.columns),
+              data_(buffer_.data()),
               size_(size)
         {}
 
         Array2D(std::vector<T> values, Size2D<size_t> size)
             : buffer_(std::move(values)),
+              data_(buffer_.data()),
               size_(size)
         {
             if (value_count() != buffer_.size())
@@ -44,16 +61,154 @@ namespace Chorasmia
             }
         }
 
+        /**
+         * @brief Adopts the buffer @a values without copying it.
+         *
+         * @a deleter is called as deleter(values) when the array no
+         * longer needs the buffer, e.g. std::free for a buffer from
+         * malloc, or a lambda that calls munmap.
+         */
+        template <std::invocable<T*> Deleter>
+        Array2D(T* values, Size2D<size_t> size, Deleter deleter)
+            : data_(values),
+              owner_(values, std::move(deleter)),
+              size_(size)
+        {}
+
+        /**
+         * @brief Uses the buffer @a values without copying it.
+         *
+         * The buffer must remain valid for as long as @a owner, or
+         * a copy of it, exists. The array keeps a copy of @a owner
+         * until it no longer needs the buffer.
+         */
+        Array2D(T* values, Size2D<size_t> size, std::shared_ptr<void> owner)
+            : data_(values),
+              owner_(std::move(owner)),
+              size_(size)
+        {
+            if (!owner_)
+                CHORASMIA_THROW("owner is null.");
+        }
+
+        /**
+         * @brief Creates a copy of @a other.
+         *
+         * The copy always stores its values in a std::vector, even if
+         * @a other uses an external buffer.
+         */
+        Array2D(const Array2D& other)
+            : buffer_(other.data_, other.data_ + other.value_count()),
+              data_(buffer_.data()),
+              size_(other.size_)
+        {}
+
+        Array2D(Array2D&& other) noexcept
+            : buffer_(std::move(other.buffer_)),
+              data_(std::exchange(other.data_, nullptr)),
+              owner_(std::move(other.owner_)),
+              size_(std::exchange(other.size_, {}))
+        {}
+
+        Array2D& operator=(const Array2D& other)
+        {
+            if (this != &other)
+                *this = Array2D(other);
+            return *this;
+        }
+
+        Array2D& operator=(Array2D&& other) noexcept
+        {
+            buffer_ = std::move(other.buffer_);
+            data_ = std::exchange(other.data_, nullptr);
+            owner_ = std::move(other.owner_);
+            size_ = std::exchange(other.size_, {});
+            return *this;
+        }
+
+        /**
+         * @brief Creates an array with a copy of the values in @a m.
+         *
+         * @a m can have any layout, including layout_left and
+         * layout_stride with arbitrary strides. The values are always
+         * copied. Use Array2D(m, owner) to use the values in a
+         * contiguous mdspan without copying them.
+         */
+        template <Mdspan2D M>
+        explicit Array2D(const M& m)
+            : size_(size_t(m.extent(0)), size_t(m.extent(1)))
+        {
+            buffer_.reserve(value_count());
+            const auto* values = m.data_handle();
+            for (size_t i = 0; i < size_.rows; ++i)
+            {
+                for (size_t j = 0; j < size_.columns; ++j)
+                    buffer_.push_back(values[i * m.stride(0) + j * m.stride(1)]);
+            }
+            data_ = buffer_.data();
+        }
+
+        /**
+         * @brief Uses the values in @a m without copying them.
+         *
+         * @a m must be contiguous and row-major, i.e. layout_right or a
+         * layout_stride with the same strides. As with
+         * Array2D(values, size, owner), the values must remain valid for
+         * as long as @a owner, or a copy of it, exists.
+         * @throw ChorasmiaException if @a m isn't contiguous and
+         *  row-major.
+         */
+        template <Mdspan2D M>
+            requires std::same_as<typename M::element_type, T>
+        Array2D(const M& m, std::shared_ptr<void> owner)
+            : Array2D(m.data_handle(),
+                      {size_t(m.extent(0)), size_t(m.extent(1))},
+                      std::move(owner))
+        {
+            if (Detail::get_row_gap(m) != 0)
+                CHORASMIA_THROW("mdspan's rows are not contiguous.");
+        }
+
+        /**
+         * @brief Creates an array with the result of evaluating @a expr.
+         *
+         * Include ArrayExpression.hpp to create expressions.
+         */
+        template <typename Func, typename... Operands>
+        Array2D(const ArrayExpression<Func, Operands...>& expr)
+            : buffer_(expr.dimensions().rows * expr.dimensions().columns),
+              data_(buffer_.data()),
+              size_(expr.dimensions())
+        {
+            expr.evaluate(mut());
+        }
+
+        /**
+         * @brief Evaluates @a expr and stores the result in this array.
+         *
+         * The array is resized if necessary. The array may itself be one
+         * of the operands in @a expr.
+         */
+        template <typename Func, typename... Operands>
+        Array2D& operator=(const ArrayExpression<Func, Operands...>& expr)
+        {
+            if (expr.dimensions() != size_)
+                *this = Array2D(expr);
+            else
+                expr.evaluate(mut());
+            return *this;
+        }
+
         [[nodiscard]]
         const T& operator[](Index2D<size_t> index) const noexcept
         {
-            return buffer_[index.row * col_count() + index.column];
+            return data_[index.row * col_count() + index.column];
         }
 
         [[nodiscard]]
         T& operator[](Index2D<size_t> index) noexcept
         {
-            return buffer_[index.row * col_count() + index.column];
+            return data_[index.row * col_count() + index.column];
         }
 
         [[nodiscard]]
@@ -71,25 +226,35 @@ namespace Chorasmia
         [[nodiscard]]
         const T* data() const noexcept
         {
-            return buffer_.data();
+            return data_;
         }
 
         [[nodiscard]]
         T* data() noexcept
         {
-            return buffer_.data();
+            return data_;
         }
 
         [[nodiscard]]
         bool empty() const noexcept
         {
-            return buffer_.empty();
+            return value_count() == 0;
         }
 
         [[nodiscard]]
         size_t size() const noexcept
         {
-            return buffer_.size();
+            return value_count();
+        }
+
+        /**
+         * @brief Returns true if the values are stored in an external
+         *  buffer rather than in a std::vector owned by the array.
+         */
+        [[nodiscard]]
+        bool has_external_buffer() const noexcept
+        {
+            return owner_ != nullptr;
         }
 
         constexpr ArrayView2D<T> view() const noexcept
@@ -162,12 +327,20 @@ namespace Chorasmia
             return size_.rows * size_.columns;
         }
 
+        /**
+         * @brief Changes the dimensions of the array while preserving the
+         *  values that are inside both the old and new dimensions.
+         *
+         * An external buffer is copied into a std::vector first.
+         */
         void resize(Size2D<size_t> size)
         {
+            make_internal();
             auto old_value_count = value_count();
             auto old_size = size_;
             auto value_count = size.rows * size.columns;
             buffer_.resize(value_count);
+            data_ = buffer_.data();
             size_ = size;
 
             if (old_size.rows == 0)
@@ -223,24 +396,35 @@ namespace Chorasmia
             return ConstIterator({data() + value_count(), col_count()});
         }
 
+        /**
+         * @brief Returns the values and leaves the array empty. Copies
+         *  all the values if the array uses an external buffer.
+         *
+         * The vector is moved out of the array in constant time when
+         * has_external_buffer() is false. Otherwise the values are
+         * copied to a new vector, which takes time proportional to the
+         * number of values, and the buffer is released.
+         */
         [[nodiscard]]
         std::vector<T> release()
         {
+            make_internal();
             size_.rows = size_.columns = 0;
+            data_ = nullptr;
             auto tmp = std::move(buffer_);
-            return std::move(tmp);
+            return tmp;
         }
 
         void fill(const T& value)
         {
-            std::fill(buffer_.begin(), buffer_.end(), value);
+            std::fill(data_, data_ + value_count(), value);
         }
 
         [[nodiscard]]
         friend bool operator==(const Array2D& a, const Array2D& b)
         {
             return a.size_ == b.size_
-                && a.buffer_ == b.buffer_;
+                && std::equal(a.data_, a.data_ + a.value_count(), b.data_);
         }
 
         [[nodiscard]]
@@ -268,7 +452,19 @@ namespace Chorasmia
         }
 
     private:
+        void make_internal()
+        {
+            if (!owner_)
+                return;
+            buffer_.assign(data_, data_ + value_count());
+            data_ = buffer_.data();
+            owner_.reset();
+        }
+
         std::vector<T> buffer_;
+        T* data_ = nullptr;
+        // Keeps an external buffer alive. Null if the values are in buffer_.
+        std::shared_ptr<void> owner_;
         Size2D<size_t> size_;
     };
 }
@@ -0,0 +1,336 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include "ArrayView2DAlgorithms.hpp"
+#include "ParallelFor.hpp"
+
+namespace Chorasmia
+{
+    enum class PyramidReduction
+    {
+        MEAN,
+        MIN,
+        MAX
+    };
+
+    /**
+     * @brief A multi-resolution pyramid (mipmap) of a 2D array.
+     *
+     * Level 0 is a copy of the original array, and each following level
+     * has half the number of rows and columns of the previous one
+     * (rounded up), down to a single value. Every value in level n + 1
+     * is the reduction of a 2x2 block in level n.
+     *
+     * All levels are stored back to back in a single buffer. Levels can
+     * be generated up front or on demand, the latter is useful when the
+     * coarse levels are rarely used.
+     *
+     * The levels are generated in bands of rows rather than one level
+     * at a time. A band is the block of rows in the finest missing level
+     * that a single row in a coarser level depends on, and a thread
+     * generates all the levels for a band while its rows are still in
+     * the cache. Every level with at least MIN_BAND_COUNT rows is
+     * generated in a single parallel pass. The remaining levels, which
+     * are small, follow in one more pass.
+     */
+    template <typename T>
+    class Array2DPyramid
+    {
+    public:
+        Array2DPyramid() = default;
+
+        /**
+         * @brief Creates a pyramid from @a base.
+         * @param base The values of level 0.
+         * @param reduction How 2x2 blocks are reduced to a single value.
+         * @param generated_levels The number of levels that are generated
+         *  immediately, the remaining levels are generated on demand.
+         *  Level 0 is always generated.
+         * @param thread_count The maximum number of threads used when
+         *  generating levels. 0 means hardware concurrency.
+         */
+        explicit Array2DPyramid(const ArrayView2D<T>& base,
+                                PyramidReduction reduction = PyramidReduction::MEAN,
+                                size_t generated_levels = SIZE_MAX,
+                                unsigned thread_count = 0)
+            : reduction_(reduction),
+              thread_count_(thread_count)
+        {
+            auto size = base.dimensions();
+            size_t value_count = 0;
+            while (!is_empty(size))
+            {
+                offsets_.push_back(value_count);
+                sizes_.push_back(size);
+                value_count += size.rows * size.columns;
+                if (size.rows == 1 && size.columns == 1)
+                    break;
+                size = {(size.rows + 1) / 2, (size.columns + 1) / 2};
+            }
+
+            if (sizes_.empty())
+                return;
+
+            buffer_.resize(value_count);
+            auto dst = buffer_.begin();
+            for (auto row : base)
+                dst = std::copy(row.begin(), row.end(), dst);
+            generated_levels_ = 1;
+
+            if (generated_levels > 1)
+                generate_levels(std::min(generated_levels, level_count()));
+        }
+
+        [[nodiscard]]
+        PyramidReduction reduction() const noexcept
+        {
+            return reduction_;
+        }
+
+        [[nodiscard]]
+        size_t level_count() const noexcept
+        {
+            return sizes_.size();
+        }
+
+        [[nodiscard]]
+        bool is_generated(size_t level) const noexcept
+        {
+            return level < generated_levels_;
+        }
+
+        [[nodiscard]]
+        Size2D<size_t> level_dimensions(size_t level) const
+        {
+            assert_valid_level(level);
+            return sizes_[level];
+        }
+
+        /**
+         * @brief Returns a view of @a level, which must have been
+         *  generated.
+         *
+         * Throws ChorasmiaException if the level hasn't been generated.
+         * Use level() to generate it on demand.
+         */
+        [[nodiscard]]
+        ArrayView2D<T> generated_level(size_t level) const
+        {
+            assert_valid_level(level);
+            if (!is_generated(level))
+                CHORASMIA_THROW("The pyramid level has not been generated.");
+            return level_view(level);
+        }
+
+        /**
+         * @brief Returns a view of @a level, generating it and any
+         *  missing levels before it if necessary.
+         */
+        [[nodiscard]]
+        ArrayView2D<T> level(size_t level)
+        {
+            assert_valid_level(level);
+            generate_levels(level + 1);
+            return level_view(level);
+        }
+
+        /**
+         * @brief Makes sure the first @a count levels have been generated.
+         */
+        void generate_levels(size_t count)
+        {
+            count = std::min(count, level_count());
+            switch (reduction_)
+            {
+            case PyramidReduction::MEAN:
+                generate_levels<PyramidReduction::MEAN>(count);
+                break;
+            case PyramidReduction::MIN:
+                generate_levels<PyramidReduction::MIN>(count);
+                break;
+            case PyramidReduction::MAX:
+                generate_levels<PyramidReduction::MAX>(count);
+                break;
+            }
+        }
+
+        /**
+         * @brief Returns the extent in @a to_level that covers @a extent
+         *  in @a from_level.
+         *
+         * When mapping to a coarser level the result includes every
+         * value that is partially covered by @a extent. The result is
+         * clamped to the dimensions of @a to_level.
+         */
+        [[nodiscard]]
+        Extent2D<size_t> map_extent(const Extent2D<size_t>& extent,
+                                    size_t from_level,
+                                    size_t to_level) const
+        {
+            assert_valid_level(from_level);
+            assert_valid_level(to_level);
+
+            Extent2D<size_t> result;
+            if (to_level >= from_level)
+            {
+                const auto shift = to_level - from_level;
+                const auto round_up = (size_t(1) << shift) - 1;
+                const auto max = extent.max_index() + Index2D(round_up, round_up);
+                result.origin = {extent.origin.row >> shift,
+                                 extent.origin.column >> shift};
+                result.size = Index2D(max.row >> shift, max.column >> shift)
+                              - result.origin;
+            }
+            else
+            {
+                const auto factor = size_t(1) << (from_level - to_level);
+                result = {extent.origin * factor, extent.size * factor};
+            }
+            return clamp(result, sizes_[to_level]);
+        }
+
+        [[nodiscard]]
+        size_t value_count() const noexcept
+        {
+            return buffer_.size();
+        }
+
+    private:
+        void assert_valid_level(size_t level) const
+        {
+            if (level >= level_count())
+            {
+                CHORASMIA_THROW("Invalid pyramid level: "
+                                + std::to_string(level));
+            }
+        }
+
+        [[nodiscard]]
+        ArrayView2D<T> level_view(size_t level) const
+        {
+            return {buffer_.data() + offsets_[level], sizes_[level]};
+        }
+
+        template <PyramidReduction Reduction>
+        void generate_levels(size_t count)
+        {
+            while (generated_levels_ < count)
+            {
+                // Generate the levels from first up to, but not including,
+                // last in one pass. Row r in level last - 1 depends on rows
+                // [r * 2^k, (r + 1) * 2^k) in level last - 1 - k, and these
+                // bands of rows don't overlap, so the bands can be
+                // generated in parallel.
+                const auto first = generated_levels_;
+                auto last = first + 1;
+                if (sizes_[first].rows < MIN_BAND_COUNT)
+                {
+                    last = count;
+                }
+                else
+                {
+                    while (last < count && sizes_[last].rows >= MIN_BAND_COUNT)
+                        ++last;
+                }
+
+                const auto band_count = sizes_[last - 1].rows;
+                const auto band_values = (size_t(1) << (last - first))
+                                         * sizes_[first - 1].columns;
+                parallel_for(band_count, [&](size_t first_band, size_t last_band)
+                    {
+                        for (auto band = first_band; band < last_band; ++band)
+                        {
+                            for (auto level = first; level < last; ++level)
+                            {
+                                const auto shift = last - 1 - level;
+                                generate_rows<Reduction>(
+                                    level, band << shift,
+                                    std::min((band + 1) << shift, sizes_[level].rows));
+                            }
+                        }
+                    },
+                    MIN_VALUES_PER_THREAD / std::max<size_t>(band_values, 1),
+                    thread_count_);
+                generated_levels_ = last;
+            }
+        }
+
+        // Generates rows [first_row, last_row) in level from the level
+        // before it.
+        template <PyramidReduction Reduction>
+        void generate_rows(size_t level, size_t first_row, size_t last_row)
+        {
+            const ArrayView2D<T> src = level_view(level - 1);
+            const MutableArrayView2D<T> dst(buffer_.data() + offsets_[level],
+                                            sizes_[level]);
+            const auto src_cols = src.col_count();
+            for (size_t i = first_row; i < last_row; ++i)
+            {
+                const auto* row0 = src.row(2 * i).data();
+                const auto* row1 = 2 * i + 1 < src.row_count()
+                                   ? src.row(2 * i + 1).data()
+                                   : row0;
+                auto* out = dst.row(i).data();
+                const auto n = dst.col_count();
+                for (size_t j = 0; j < n; ++j)
+                {
+                    const auto c0 = 2 * j;
+                    const auto c1 = std::min(c0 + 1, src_cols - 1);
+                    out[j] = reduce<Reduction>(row0[c0], row0[c1],
+                                               row1[c0], row1[c1]);
+                }
+            }
+        }
+
+        // Odd rows and columns at the edges are handled by repeating the
+        // last row or column, which doesn't affect any of the reductions.
+        template <PyramidReduction Reduction>
+        static T reduce(const T& a, const T& b, const T& c, const T& d)
+        {
+            if constexpr (Reduction == PyramidReduction::MIN)
+            {
+                return std::min(std::min(a, b), std::min(c, d));
+            }
+            else if constexpr (Reduction == PyramidReduction::MAX)
+            {
+                return std::max(std::max(a, b), std::max(c, d));
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                const auto sum = double(a) + double(b) + double(c) + double(d);
+                return static_cast<T>(std::round(sum * 0.25));
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                return static_cast<T>((a + b + c + d) * 0.25);
+            }
+            else
+            {
+                static_assert(AddableAndScalarMultipliable<T>,
+                              "MEAN requires T to support + and * double.");
+                return T(T(T(a + b) + c) + d) * 0.25;
+            }
+        }
+
+        static constexpr size_t MIN_VALUES_PER_THREAD = 64 * 1024;
+        // Levels with fewer rows than this are generated after the
+        // others, since they would leave too few bands to divide between
+        // threads.
+        static constexpr size_t MIN_BAND_COUNT = 64;
+
+        std::vector<T> buffer_;
+        std::vector<size_t> offsets_;
+        std::vector<Size2D<size_t>> sizes_;
+        size_t generated_levels_ = 0;
+        PyramidReduction reduction_ = PyramidReduction::MEAN;
+        unsigned thread_count_ = 0;
+    };
+}
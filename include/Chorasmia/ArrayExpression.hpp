@@ -0,0 +1,355 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include "Array2D.hpp"
+
+namespace Chorasmia
+{
+    namespace Detail
+    {
+        template <typename T>
+        struct ViewTerminal
+        {
+            using value_type = T;
+
+            ArrayView2D<T> view;
+
+            [[nodiscard]]
+            Size2D<size_t> dimensions() const noexcept
+            {
+                return view.dimensions();
+            }
+
+            [[nodiscard]]
+            bool contiguous() const noexcept
+            {
+                return view.contiguous();
+            }
+
+            [[nodiscard]]
+            const T* row(size_t i) const noexcept
+            {
+                return view.data() + i * (view.col_count() + view.row_gap());
+            }
+        };
+
+        template <typename T>
+        struct ScalarTerminal
+        {
+            using value_type = T;
+
+            struct Row
+            {
+                T value;
+
+                T operator[](size_t) const noexcept
+                {
+                    return value;
+                }
+            };
+
+            T value;
+
+            [[nodiscard]]
+            bool contiguous() const noexcept
+            {
+                return true;
+            }
+
+            [[nodiscard]]
+            Row row(size_t) const noexcept
+            {
+                return {value};
+            }
+        };
+
+        template <typename Func, typename... Rows>
+        struct ExpressionRow
+        {
+            const Func* func;
+            std::tuple<Rows...> rows;
+
+            decltype(auto) operator[](size_t i) const
+            {
+                return std::apply([&](const auto&... r) {return (*func)(r[i]...);},
+                                  rows);
+            }
+        };
+
+        template <typename T>
+        struct IsScalarOperand : std::false_type
+        {};
+
+        template <typename T>
+        struct IsScalarOperand<ScalarTerminal<T>> : std::true_type
+        {};
+    }
+
+    /**
+     * @brief A lazily evaluated element-wise operation on one or more
+     *  2D arrays.
+     *
+     * Expressions are normally created with the arithmetic operators
+     * on ArrayView2D, MutableArrayView2D, Array2D and other
+     * expressions, or with make_array_expression. Nothing is computed
+     * until the expression is assigned to an Array2D or passed to
+     * assign, at which point the entire expression tree is evaluated
+     * in a single pass without temporary arrays.
+     *
+     * Expressions refer to the arrays they are made from and must not
+     * outlive them.
+     */
+    template <typename Func, typename... Operands>
+    class ArrayExpression
+    {
+    public:
+        using value_type = std::remove_cvref_t<std::invoke_result_t<
+            const Func&, typename Operands::value_type...>>;
+
+        explicit ArrayExpression(Func func, Operands... operands)
+            : func_(std::move(func)),
+              operands_(std::move(operands)...)
+        {
+            bool has_size = false;
+            auto check = [&](const auto& operand)
+            {
+                using Operand = std::remove_cvref_t<decltype(operand)>;
+                if constexpr (!Detail::IsScalarOperand<Operand>::value)
+                {
+                    if (!has_size)
+                    {
+                        size_ = operand.dimensions();
+                        has_size = true;
+                    }
+                    else if (operand.dimensions() != size_)
+                    {
+                        CHORASMIA_THROW("Operands have different dimensions: "
+                                        + std::to_string(size_.rows) + "x"
+                                        + std::to_string(size_.columns) + " and "
+                                        + std::to_string(operand.dimensions().rows) + "x"
+                                        + std::to_string(operand.dimensions().columns)
+                                        + ".");
+                    }
+                }
+            };
+            std::apply([&](const auto&... op) {(check(op), ...);}, operands_);
+        }
+
+        [[nodiscard]]
+        Size2D<size_t> dimensions() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]]
+        bool contiguous() const noexcept
+        {
+            return std::apply([](const auto&... op) {return (op.contiguous() && ...);},
+                              operands_);
+        }
+
+        /**
+         * @brief Returns an object whose operator[](j) computes the
+         *  value at row @a i and column j.
+         */
+        [[nodiscard]]
+        auto row(size_t i) const noexcept
+        {
+            return std::apply([&](const auto&... op)
+                              {
+                                  return Detail::ExpressionRow<Func, decltype(op.row(i))...>{
+                                      &func_, {op.row(i)...}};
+                              },
+                              operands_);
+        }
+
+        /**
+         * @brief Evaluates the expression and writes the result to
+         *  @a dst.
+         *
+         * @a dst may be one of the arrays in the expression.
+         */
+        template <typename T>
+        void evaluate(const MutableArrayView2D<T>& dst) const
+        {
+            if (dst.dimensions() != size_)
+                CHORASMIA_THROW("dst has incorrect dimensions.");
+
+            if (size_.rows == 0)
+                return;
+
+            if (contiguous() && dst.contiguous())
+            {
+                evaluate_row(dst.data(), row(0), dst.value_count());
+                return;
+            }
+
+            for (size_t i = 0; i < size_.rows; ++i)
+                evaluate_row(dst.row(i).data(), row(i), size_.columns);
+        }
+
+    private:
+        template <typename T, typename Row>
+        static void evaluate_row(T* dst, const Row& src, size_t n)
+        {
+            for (size_t j = 0; j < n; ++j)
+                dst[j] = T(src[j]);
+        }
+
+        Func func_;
+        std::tuple<Operands...> operands_;
+        Size2D<size_t> size_;
+    };
+
+    template <typename Func, typename... Operands>
+    Array2D(const ArrayExpression<Func, Operands...>&)
+        -> Array2D<typename ArrayExpression<Func, Operands...>::value_type>;
+
+    namespace Detail
+    {
+        template <typename T>
+        struct IsArrayOperand : std::false_type
+        {};
+
+        template <typename T>
+        struct IsArrayOperand<ArrayView2D<T>> : std::true_type
+        {};
+
+        template <typename T>
+        struct IsArrayOperand<MutableArrayView2D<T>> : std::true_type
+        {};
+
+        template <typename T>
+        struct IsArrayOperand<Array2D<T>> : std::true_type
+        {};
+
+        template <typename Func, typename... Operands>
+        struct IsArrayOperand<ArrayExpression<Func, Operands...>> : std::true_type
+        {};
+    }
+
+    /**
+     * @brief Satisfied by the types that can be used as arrays in an
+     *  ArrayExpression.
+     */
+    template <typename T>
+    concept ArrayOperand = Detail::IsArrayOperand<std::remove_cvref_t<T>>::value;
+
+    /**
+     * @brief Satisfied by the types that can be used as scalars in an
+     *  ArrayExpression.
+     */
+    template <typename T>
+    concept ScalarOperand = std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+    namespace Detail
+    {
+        template <typename T>
+        auto make_operand(const ArrayView2D<T>& view)
+        {
+            return ViewTerminal<T>{view};
+        }
+
+        template <typename T>
+        auto make_operand(const MutableArrayView2D<T>& view)
+        {
+            return ViewTerminal<T>{view.view()};
+        }
+
+        template <typename T>
+        auto make_operand(const Array2D<T>& array)
+        {
+            return ViewTerminal<T>{array.view()};
+        }
+
+        template <typename Func, typename... Operands>
+        auto make_operand(const ArrayExpression<Func, Operands...>& expr)
+        {
+            return expr;
+        }
+
+        template <ScalarOperand T>
+        auto make_operand(T value)
+        {
+            return Detail::ScalarTerminal<T>{value};
+        }
+    }
+
+    /**
+     * @brief Creates an expression that computes func(args[i, j]...)
+     *  for every position (i, j).
+     *
+     * At least one of @a args must be an ArrayOperand, the others may
+     * be scalars.
+     */
+    template <typename Func, typename... Args>
+        requires ((ArrayOperand<Args> || ScalarOperand<Args>) && ...)
+                 && (ArrayOperand<Args> || ...)
+    [[nodiscard]]
+    auto make_array_expression(Func func, const Args&... args)
+    {
+        return ArrayExpression<Func, decltype(Detail::make_operand(args))...>(
+            std::move(func), Detail::make_operand(args)...);
+    }
+
+    /**
+     * @brief Evaluates @a expr and writes the result to @a dst.
+     */
+    template <typename T, typename Func, typename... Operands>
+    void assign(const MutableArrayView2D<T>& dst,
+                const ArrayExpression<Func, Operands...>& expr)
+    {
+        expr.evaluate(dst);
+    }
+
+    template <typename A, typename B>
+        requires (ArrayOperand<A> && (ArrayOperand<B> || ScalarOperand<B>))
+                 || (ScalarOperand<A> && ArrayOperand<B>)
+    [[nodiscard]]
+    auto operator+(const A& a, const B& b)
+    {
+        return make_array_expression(std::plus<>(), a, b);
+    }
+
+    template <typename A, typename B>
+        requires (ArrayOperand<A> && (ArrayOperand<B> || ScalarOperand<B>))
+                 || (ScalarOperand<A> && ArrayOperand<B>)
+    [[nodiscard]]
+    auto operator-(const A& a, const B& b)
+    {
+        return make_array_expression(std::minus<>(), a, b);
+    }
+
+    template <typename A, typename B>
+        requires (ArrayOperand<A> && (ArrayOperand<B> || ScalarOperand<B>))
+                 || (ScalarOperand<A> && ArrayOperand<B>)
+    [[nodiscard]]
+    auto operator*(const A& a, const B& b)
+    {
+        return make_array_expression(std::multiplies<>(), a, b);
+    }
+
+    template <typename A, typename B>
+        requires (ArrayOperand<A> && (ArrayOperand<B> || ScalarOperand<B>))
+                 || (ScalarOperand<A> && ArrayOperand<B>)
+    [[nodiscard]]
+    auto operator/(const A& a, const B& b)
+    {
+        return make_array_expression(std::divides<>(), a, b);
+    }
+
+    template <ArrayOperand A>
+    [[nodiscard]]
+    auto operator-(const A& a)
+    {
+        return make_array_expression(std::negate<>(), a);
+    }
+}
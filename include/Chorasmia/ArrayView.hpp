@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include <cstddef>
+#include <ranges>
 
 namespace Chorasmia
 {
@@ -83,3 +84,11 @@ namespace Chorasmia
         return a.data() == b.data() && a.size() == b.size();
     }
 }
+
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    Chorasmia::ArrayView<T>> = true;
+
+template <typename T>
+inline constexpr bool std::ranges::enable_view<
+    Chorasmia::ArrayView<T>> = true;
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <vector>
 #include "ChorasmiaException.hpp"
+#include "ArrayView2DElements.hpp"
 #include "ArrayView2DIterator.hpp"
 #include "Extent2D.hpp"
 #include "Index2D.hpp"
@@ -101,9 +102,9 @@ namespace Chorasmia
         {
             extent = clamp(extent, size_);
             return {
-                data() + extent.origin.row * col_count() + extent.origin.column,
+                data() + extent.origin.row * row_size() + extent.origin.column,
                 extent.size,
-                col_count() - extent.size.columns
+                row_size() - extent.size.columns
             };
         }
 
@@ -131,6 +132,26 @@ namespace Chorasmia
             return size_.rows * size_.columns;
         }
 
+        /**
+         * @brief The number of values between the end of one row and the
+         *  start of the next.
+         */
+        [[nodiscard]]
+        constexpr size_t row_gap() const noexcept
+        {
+            return row_gap_;
+        }
+
+        /**
+         * @brief Returns a random access range of all the values in the
+         *  view, row by row.
+         */
+        [[nodiscard]]
+        constexpr ArrayView2DElements<T> elements() const noexcept
+        {
+            return {data_, row_count(), col_count(), row_gap_};
+        }
+
         [[nodiscard]]
         ConstIterator begin() const noexcept
         {
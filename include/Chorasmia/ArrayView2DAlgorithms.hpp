@@ -10,6 +10,7 @@
 #include <cmath>
 #include "MutableArrayView2D.hpp"
 #include "Index2DMapping.hpp"
+#include "ParallelFor.hpp"
 
 namespace Chorasmia
 {
@@ -55,6 +56,177 @@ namespace Chorasmia
         }
     }
 
+    namespace Detail
+    {
+        constexpr size_t MIN_TRANSFORM_VALUES_PER_THREAD = 32 * 1024;
+
+        // Plain loops over raw pointers that the compiler can vectorize.
+        template <typename T, typename U, typename Func>
+        void transform_values(const T* src, U* dst, size_t n, Func& func)
+        {
+            for (size_t i = 0; i < n; ++i)
+                dst[i] = func(src[i]);
+        }
+
+        template <typename T1, typename T2, typename U, typename Func>
+        void transform_values(const T1* a, const T2* b, U* dst, size_t n,
+                              Func& func)
+        {
+            for (size_t i = 0; i < n; ++i)
+                dst[i] = func(a[i], b[i]);
+        }
+
+        template <typename T, typename U, typename Func>
+        void transform_rows(const ArrayView2D<T>& src,
+                            const MutableArrayView2D<U>& dst,
+                            Func& func, size_t first_row, size_t last_row)
+        {
+            for (size_t i = first_row; i < last_row; ++i)
+            {
+                transform_values(src.row(i).data(), dst.row(i).data(),
+                                 src.col_count(), func);
+            }
+        }
+
+        template <typename T1, typename T2, typename U, typename Func>
+        void transform_rows(const ArrayView2D<T1>& a,
+                            const ArrayView2D<T2>& b,
+                            const MutableArrayView2D<U>& dst,
+                            Func& func, size_t first_row, size_t last_row)
+        {
+            for (size_t i = first_row; i < last_row; ++i)
+            {
+                transform_values(a.row(i).data(), b.row(i).data(),
+                                 dst.row(i).data(), a.col_count(), func);
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns func(src[i, j]) to dst[i, j] for every value in
+     *  @a src.
+     *
+     * The views are processed row by row through raw pointers, and as
+     * a single flat loop if both views are contiguous.
+     */
+    template <typename T, typename U, typename Func>
+    void transform(const ArrayView2D<T>& src,
+                   const MutableArrayView2D<U>& dst,
+                   Func func)
+    {
+        if (src.dimensions() != dst.dimensions())
+            CHORASMIA_THROW("dst has incorrect dimensions.");
+
+        if (src.contiguous() && dst.contiguous())
+            Detail::transform_values(src.data(), dst.data(), src.value_count(), func);
+        else
+            Detail::transform_rows(src, dst, func, 0, src.row_count());
+    }
+
+    /**
+     * @brief Assigns func(a[i, j], b[i, j]) to dst[i, j] for every value
+     *  in @a a and @a b.
+     */
+    template <typename T1, typename T2, typename U, typename Func>
+    void transform(const ArrayView2D<T1>& a,
+                   const ArrayView2D<T2>& b,
+                   const MutableArrayView2D<U>& dst,
+                   Func func)
+    {
+        if (a.dimensions() != b.dimensions())
+            CHORASMIA_THROW("a and b have different dimensions.");
+        if (a.dimensions() != dst.dimensions())
+            CHORASMIA_THROW("dst has incorrect dimensions.");
+
+        if (a.contiguous() && b.contiguous() && dst.contiguous())
+        {
+            Detail::transform_values(a.data(), b.data(), dst.data(),
+                                     a.value_count(), func);
+        }
+        else
+        {
+            Detail::transform_rows(a, b, dst, func, 0, a.row_count());
+        }
+    }
+
+    /**
+     * @brief Multi-threaded version of transform(src, dst, func).
+     *
+     * @a func is called concurrently from several threads.
+     */
+    template <typename T, typename U, typename Func>
+    void transform(ParallelPolicy policy,
+                   const ArrayView2D<T>& src,
+                   const MutableArrayView2D<U>& dst,
+                   Func func)
+    {
+        if (src.dimensions() != dst.dimensions())
+            CHORASMIA_THROW("dst has incorrect dimensions.");
+
+        if (src.contiguous() && dst.contiguous())
+        {
+            parallel_for(src.value_count(), [&](size_t first, size_t last)
+                {
+                    Detail::transform_values(src.data() + first,
+                                             dst.data() + first,
+                                             last - first, func);
+                },
+                Detail::MIN_TRANSFORM_VALUES_PER_THREAD,
+                policy.thread_count);
+        }
+        else
+        {
+            parallel_for(src.row_count(), [&](size_t first, size_t last)
+                {
+                    Detail::transform_rows(src, dst, func, first, last);
+                },
+                Detail::MIN_TRANSFORM_VALUES_PER_THREAD
+                / std::max<size_t>(src.col_count(), 1),
+                policy.thread_count);
+        }
+    }
+
+    /**
+     * @brief Multi-threaded version of transform(a, b, dst, func).
+     *
+     * @a func is called concurrently from several threads.
+     */
+    template <typename T1, typename T2, typename U, typename Func>
+    void transform(ParallelPolicy policy,
+                   const ArrayView2D<T1>& a,
+                   const ArrayView2D<T2>& b,
+                   const MutableArrayView2D<U>& dst,
+                   Func func)
+    {
+        if (a.dimensions() != b.dimensions())
+            CHORASMIA_THROW("a and b have different dimensions.");
+        if (a.dimensions() != dst.dimensions())
+            CHORASMIA_THROW("dst has incorrect dimensions.");
+
+        if (a.contiguous() && b.contiguous() && dst.contiguous())
+        {
+            parallel_for(a.value_count(), [&](size_t first, size_t last)
+                {
+                    Detail::transform_values(a.data() + first,
+                                             b.data() + first,
+                                             dst.data() + first,
+                                             last - first, func);
+                },
+                Detail::MIN_TRANSFORM_VALUES_PER_THREAD,
+                policy.thread_count);
+        }
+        else
+        {
+            parallel_for(a.row_count(), [&](size_t first, size_t last)
+                {
+                    Detail::transform_rows(a, b, dst, func, first, last);
+                },
+                Detail::MIN_TRANSFORM_VALUES_PER_THREAD
+                / std::max<size_t>(a.col_count(), 1),
+                policy.thread_count);
+        }
+    }
+
     /**
      * @brief A concept for types that can be multiplied by a scalar.
      */
@@ -0,0 +1,266 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include "ArrayView.hpp"
+#include "MutableArrayView.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief A random access iterator over the individual values in a
+     *  2D view, row by row, skipping the gaps between the rows.
+     */
+    template <typename T, bool IsMutable = false>
+    class ArrayView2DElementIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<IsMutable, T*, const T*>;
+        using reference = std::conditional_t<IsMutable, T&, const T&>;
+
+        constexpr ArrayView2DElementIterator() = default;
+
+        constexpr ArrayView2DElementIterator(pointer ptr, size_t column,
+                                             size_t col_count,
+                                             size_t row_gap) noexcept
+            : ptr_(ptr),
+              column_(ptrdiff_t(column)),
+              col_count_(ptrdiff_t(col_count)),
+              row_gap_(ptrdiff_t(row_gap))
+        {}
+
+        /**
+         * @brief Makes a const iterator from a mutable one.
+         */
+        template <bool OtherIsMutable>
+            requires (OtherIsMutable && !IsMutable)
+        constexpr ArrayView2DElementIterator(
+            const ArrayView2DElementIterator<T, OtherIsMutable>& it) noexcept
+            : ptr_(it.ptr_),
+              column_(it.column_),
+              col_count_(it.col_count_),
+              row_gap_(it.row_gap_)
+        {}
+
+        [[nodiscard]]
+        constexpr reference operator*() const noexcept
+        {
+            return *ptr_;
+        }
+
+        [[nodiscard]]
+        constexpr pointer operator->() const noexcept
+        {
+            return ptr_;
+        }
+
+        [[nodiscard]]
+        constexpr reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        constexpr ArrayView2DElementIterator& operator++() noexcept
+        {
+            ++ptr_;
+            if (++column_ == col_count_)
+            {
+                ptr_ += row_gap_;
+                column_ = 0;
+            }
+            return *this;
+        }
+
+        constexpr ArrayView2DElementIterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        constexpr ArrayView2DElementIterator& operator--() noexcept
+        {
+            if (column_ == 0)
+            {
+                ptr_ -= row_gap_;
+                column_ = col_count_;
+            }
+            --ptr_;
+            --column_;
+            return *this;
+        }
+
+        constexpr ArrayView2DElementIterator operator--(int) noexcept
+        {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        constexpr ArrayView2DElementIterator& operator+=(difference_type n) noexcept
+        {
+            if (n == 0)
+                return *this;
+            auto column = column_ + n;
+            auto rows = column / col_count_;
+            column -= rows * col_count_;
+            if (column < 0)
+            {
+                column += col_count_;
+                --rows;
+            }
+            ptr_ += n + rows * row_gap_;
+            column_ = column;
+            return *this;
+        }
+
+        constexpr ArrayView2DElementIterator& operator-=(difference_type n) noexcept
+        {
+            return *this += -n;
+        }
+
+        [[nodiscard]]
+        friend constexpr ArrayView2DElementIterator
+        operator+(ArrayView2DElementIterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        [[nodiscard]]
+        friend constexpr ArrayView2DElementIterator
+        operator+(difference_type n, ArrayView2DElementIterator it) noexcept
+        {
+            return it += n;
+        }
+
+        [[nodiscard]]
+        friend constexpr ArrayView2DElementIterator
+        operator-(ArrayView2DElementIterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        [[nodiscard]]
+        friend constexpr difference_type
+        operator-(const ArrayView2DElementIterator& a,
+                  const ArrayView2DElementIterator& b) noexcept
+        {
+            const auto row_size = a.col_count_ + a.row_gap_;
+            if (row_size == 0)
+                return 0;
+            const auto rows = ((a.ptr_ - a.column_) - (b.ptr_ - b.column_))
+                              / row_size;
+            return rows * a.col_count_ + a.column_ - b.column_;
+        }
+
+        [[nodiscard]]
+        friend constexpr bool
+        operator==(const ArrayView2DElementIterator& a,
+                   const ArrayView2DElementIterator& b) noexcept
+        {
+            return a.ptr_ == b.ptr_;
+        }
+
+        [[nodiscard]]
+        friend constexpr std::strong_ordering
+        operator<=>(const ArrayView2DElementIterator& a,
+                    const ArrayView2DElementIterator& b) noexcept
+        {
+            return std::compare_three_way()(a.ptr_, b.ptr_);
+        }
+
+    private:
+        template <typename, bool>
+        friend class ArrayView2DElementIterator;
+
+        pointer ptr_ = nullptr;
+        ptrdiff_t column_ = 0;
+        ptrdiff_t col_count_ = 0;
+        ptrdiff_t row_gap_ = 0;
+    };
+
+    /**
+     * @brief A std::ranges view of the individual values in a 2D view.
+     *
+     * Use ArrayView2D::elements() or MutableArrayView2D::elements() to
+     * create it.
+     */
+    template <typename T, bool IsMutable = false>
+    class ArrayView2DElements
+        : public std::ranges::view_interface<ArrayView2DElements<T, IsMutable>>
+    {
+    public:
+        using Iterator = ArrayView2DElementIterator<T, IsMutable>;
+        using pointer = typename Iterator::pointer;
+
+        constexpr ArrayView2DElements() = default;
+
+        constexpr ArrayView2DElements(pointer data, size_t row_count,
+                                      size_t col_count,
+                                      size_t row_gap) noexcept
+            : data_(data),
+              row_count_(row_count),
+              col_count_(col_count),
+              row_gap_(row_gap)
+        {}
+
+        [[nodiscard]]
+        constexpr Iterator begin() const noexcept
+        {
+            return {data_, 0, col_count_, row_gap_};
+        }
+
+        [[nodiscard]]
+        constexpr Iterator end() const noexcept
+        {
+            if (col_count_ == 0)
+                return begin();
+            return {data_ + row_count_ * (col_count_ + row_gap_),
+                    0, col_count_, row_gap_};
+        }
+
+        [[nodiscard]]
+        constexpr size_t size() const noexcept
+        {
+            return row_count_ * col_count_;
+        }
+
+    private:
+        pointer data_ = nullptr;
+        size_t row_count_ = 0;
+        size_t col_count_ = 0;
+        size_t row_gap_ = 0;
+    };
+
+    /**
+     * @brief Calls @a func with a range of all the values in @a view.
+     *
+     * The range is an ArrayView, which is a std::ranges::contiguous_range,
+     * if @a view is contiguous, and an ArrayView2DElements otherwise.
+     * @a func must return the same type for both.
+     */
+    template <typename View, typename Func>
+    decltype(auto) visit_elements(const View& view, Func func)
+    {
+        if (view.contiguous())
+            return func(view.array());
+        return func(view.elements());
+    }
+}
+
+template <typename T, bool IsMutable>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    Chorasmia::ArrayView2DElements<T, IsMutable>> = true;
@@ -0,0 +1,180 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "SegmentedIntervalMap.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief An interval map for many reader threads and occasional
+     *  writers.
+     *
+     * Readers never see the map change. Instead they look up
+     * keys in an immutable snapshot of it. A writer copies the current
+     * snapshot, modifies the copy and publishes it as the new snapshot
+     * with an atomic store. Writers are serialized by a mutex, and
+     * readers never lock it.
+     *
+     * The snapshots are SegmentedIntervalMaps, which share the leaves
+     * they haven't modified. An update therefore only copies the leaves
+     * it changes, plus one pointer and one key per leaf.
+     *
+     * Each reader thread should have its own Reader. A Reader keeps a
+     * reference to a snapshot and the version number it had when it
+     * was published, and lookups only check the version with a single
+     * atomic load. Lookups are therefore wait-free, except the first
+     * one after an update, which fetches the new snapshot. The
+     * snapshots are reference counted. An old snapshot, and the leaves
+     * only it uses, is freed when the last Reader that uses it moves on
+     * to a newer version or is destroyed.
+     */
+    template <typename Key, typename Value, size_t LeafSize = 256>
+    class ConcurrentIntervalMap
+    {
+    public:
+        using Map = SegmentedIntervalMap<Key, Value, LeafSize>;
+        using Snapshot = std::shared_ptr<const Map>;
+
+        /**
+         * @brief A per-thread handle for looking up keys in the latest
+         *  snapshot of a ConcurrentIntervalMap.
+         *
+         * The ConcurrentIntervalMap must outlive its readers.
+         */
+        class Reader
+        {
+        public:
+            explicit Reader(const ConcurrentIntervalMap& map)
+                : map_(&map),
+                  // Read the version first, the snapshot is then at
+                  // least as new as the version.
+                  version_(map.version()),
+                  snapshot_(map.snapshot())
+            {}
+
+            /**
+             * @brief Returns the latest snapshot.
+             *
+             * The reference remains valid until the next call to get
+             * or find on this reader.
+             */
+            [[nodiscard]]
+            const Map& get()
+            {
+                const auto version = map_->version();
+                if (version != version_)
+                {
+                    snapshot_ = map_->snapshot();
+                    version_ = version;
+                }
+                return *snapshot_;
+            }
+
+            /**
+             * @brief Returns the value of the interval that contains
+             *  @a key in the latest snapshot.
+             *
+             * The reference remains valid until the next call to get
+             * or find on this reader.
+             */
+            [[nodiscard]]
+            const Value& find(Key key)
+            {
+                return get().find(key)->second;
+            }
+
+            [[nodiscard]]
+            uint64_t version() const
+            {
+                return version_;
+            }
+
+        private:
+            const ConcurrentIntervalMap* map_;
+            uint64_t version_;
+            Snapshot snapshot_;
+        };
+
+        explicit ConcurrentIntervalMap(Value defaultValue = {},
+                                       Key margin = get_default_margin<Key>())
+            : snapshot_(std::make_shared<const Map>(std::move(defaultValue),
+                                                    margin))
+        {}
+
+        ConcurrentIntervalMap(const ConcurrentIntervalMap&) = delete;
+
+        ConcurrentIntervalMap& operator=(const ConcurrentIntervalMap&) = delete;
+
+        /**
+         * @brief Returns the current snapshot.
+         *
+         * The snapshot stays the same when the map is updated
+         * afterwards.
+         */
+        [[nodiscard]]
+        Snapshot snapshot() const
+        {
+            return snapshot_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Returns the number of updates that have been
+         *  published.
+         */
+        [[nodiscard]]
+        uint64_t version() const
+        {
+            return version_.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        Reader reader() const
+        {
+            return Reader(*this);
+        }
+
+        void insert(Key key, Value value)
+        {
+            update([&](Map& map) {map.insert(key, std::move(value));});
+        }
+
+        void insert(Key from, Key to, Value value)
+        {
+            update([&](Map& map) {map.insert(from, to, std::move(value));});
+        }
+
+        /**
+         * @brief Calls @a func with a copy of the current snapshot and
+         *  publishes the result as the new snapshot.
+         *
+         * Readers see either all or none of the changes @a func makes.
+         * If @a func throws, nothing is published.
+         */
+        template <typename Func>
+        void update(Func func)
+        {
+            std::lock_guard lock(mutex_);
+            auto map = *snapshot_.load(std::memory_order_relaxed);
+            func(map);
+            snapshot_.store(std::make_shared<const Map>(std::move(map)),
+                            std::memory_order_release);
+            // Readers that see the new version will also see the
+            // new snapshot.
+            version_.fetch_add(1, std::memory_order_release);
+        }
+
+    private:
+        std::mutex mutex_;
+        std::atomic<Snapshot> snapshot_;
+        std::atomic<uint64_t> version_ = 0;
+    };
+}
@@ -0,0 +1,166 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <vector>
+#include "IntervalMap.hpp"
+
+namespace Chorasmia
+{
+    template <typename Key, typename Value, size_t LeafSize>
+    class SegmentedIntervalMap;
+
+    namespace Detail
+    {
+        // Keeps std::vector<bool> from packing the values, so that find
+        // can return a reference to them.
+        template <typename Value>
+        struct FrozenValue
+        {
+            Value value;
+        };
+    }
+
+    /**
+     * @brief A read-only copy of an IntervalMap that is optimized for
+     *  lookups.
+     *
+     * The keys and values are stored in separate arrays, so a search
+     * only touches keys. The keys are in Eytzinger order: the root of
+     * an implicit binary search tree at index 1 and the children of
+     * node k at 2k and 2k + 1, i.e. breadth first. The first few levels
+     * of the tree share a handful of cache lines, and the search
+     * descends with a branchless comparison while it prefetches the
+     * nodes four levels further down.
+     *
+     * find returns the same value as IntervalMap::find, including the
+     * margin for floating point keys.
+     */
+    template <typename Key, typename Value>
+    class FrozenIntervalMap
+    {
+    public:
+        FrozenIntervalMap() = default;
+
+        /**
+         * @brief Creates a frozen copy of @a map, which is an IntervalMap
+         *  or a SegmentedIntervalMap.
+         */
+        template <typename Map>
+            requires requires (const Map& m)
+            {
+                {m.margin()} -> std::convertible_to<Key>;
+                {m.size()} -> std::convertible_to<size_t>;
+                {*m.begin()} -> std::convertible_to<std::pair<Key, Value>>;
+            }
+        explicit FrozenIntervalMap(const Map& map)
+            : keys_(map.size() + 1),
+              values_(map.size() + 1),
+              margin_(map.margin())
+        {
+            auto it = map.begin();
+            // A key that is less than every boundary, e.g. -infinity,
+            // turns left all the way down, and find_impl returns 0.
+            // Like IntervalMap::find, it gets the first boundary.
+            keys_[0] = it->first;
+            values_[0].value = it->second;
+            fill(it, 1);
+        }
+
+        /**
+         * @brief Returns the value of the interval that contains @a key.
+         *
+         * The map must not be empty.
+         */
+        [[nodiscard]]
+        const Value& find(Key key) const
+        {
+            return values_[find_impl(key)].value;
+        }
+
+        /**
+         * @brief Returns the start of the interval that contains @a key.
+         */
+        [[nodiscard]]
+        Key find_boundary(Key key) const
+        {
+            return keys_[find_impl(key)];
+        }
+
+        /**
+         * @brief Returns the number of boundaries, including the two at
+         *  the lowest and highest possible keys.
+         */
+        [[nodiscard]]
+        size_t size() const
+        {
+            return keys_.empty() ? 0 : keys_.size() - 1;
+        }
+
+        [[nodiscard]]
+        Key margin() const
+        {
+            return margin_;
+        }
+
+    private:
+        // Nodes four levels below k start at 16k, which is one cache line
+        // of 4-byte keys.
+        static constexpr size_t PREFETCH_STRIDE = 16;
+
+        // Fills the subtree rooted at k with consecutive boundaries from
+        // it, in order.
+        template <typename It>
+        void fill(It& it, size_t k)
+        {
+            if (k >= keys_.size())
+                return;
+            fill(it, 2 * k);
+            keys_[k] = it->first;
+            values_[k].value = it->second;
+            ++it;
+            fill(it, 2 * k + 1);
+        }
+
+        [[nodiscard]]
+        size_t find_impl(Key key) const
+        {
+            const auto* keys = keys_.data();
+            const auto n = keys_.size();
+            size_t k = 1;
+            while (k < n)
+            {
+#if defined(__GNUC__)
+                __builtin_prefetch(keys + PREFETCH_STRIDE * k);
+#endif
+                k = 2 * k + size_t(!Detail::is_interval_key_less(key, keys[k], margin_));
+            }
+            // The path to k is a sequence of left (0) and right (1) turns.
+            // The result is the node where it last turned right, i.e. the
+            // last key that isn't greater than the search key. Shifting
+            // out the trailing zeros and the one before them gets there.
+            return k >> (std::countr_zero(k) + 1);
+        }
+
+        // The root is at index 1. Index 0 has a copy of the first
+        // boundary.
+        std::vector<Key> keys_;
+        std::vector<Detail::FrozenValue<Value>> values_;
+        Key margin_ = {};
+    };
+
+    template <typename Key, typename Value>
+    FrozenIntervalMap(const IntervalMap<Key, Value>&) -> FrozenIntervalMap<Key, Value>;
+
+    template <typename Key, typename Value, size_t LeafSize>
+    FrozenIntervalMap(const SegmentedIntervalMap<Key, Value, LeafSize>&)
+        -> FrozenIntervalMap<Key, Value>;
+}
@@ -0,0 +1,478 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "ArrayView2D.hpp"
+
+namespace Chorasmia
+{
+    enum class PathAlgorithm
+    {
+        DIJKSTRA,
+        A_STAR,
+        /// Jump Point Search. Only valid for grids where all passable
+        /// cells have the same cost, and requires
+        /// GridNeighborhood::EIGHT. It is fastest on maps with corridors
+        /// and rooms, on open or noisy grids plain A* is often faster.
+        JUMP_POINT_SEARCH
+    };
+
+    enum class GridNeighborhood
+    {
+        FOUR,
+        EIGHT
+    };
+
+    struct GridPathOptions
+    {
+        PathAlgorithm algorithm = PathAlgorithm::A_STAR;
+        GridNeighborhood neighborhood = GridNeighborhood::EIGHT;
+        /// The smallest cost of any passable cell. A* multiplies its
+        /// distance heuristic by this value, it must not be larger than
+        /// the actual minimum cost if the paths are to be optimal.
+        float min_cost = 1;
+    };
+
+    /**
+     * @brief Finds shortest paths in grids of cell costs.
+     *
+     * Moving into a cell costs the cell's value multiplied by the length
+     * of the step (1 or sqrt(2) for diagonal steps). Cells with negative,
+     * infinite or NaN costs are impassable, and diagonal steps are only
+     * allowed when both of the adjacent orthogonal cells are passable.
+     *
+     * All the buffers used by the search are kept between queries, so
+     * once the finder has been used with a grid of a given size,
+     * subsequent queries don't allocate memory (other than what the
+     * caller's path vector may need).
+     */
+    class GridPathFinder
+    {
+    public:
+        explicit GridPathFinder(GridPathOptions options = {})
+            : options_(options)
+        {
+            if (options_.algorithm == PathAlgorithm::JUMP_POINT_SEARCH
+                && options_.neighborhood != GridNeighborhood::EIGHT)
+            {
+                CHORASMIA_THROW("Jump Point Search requires an eight-cell neighborhood.");
+            }
+        }
+
+        [[nodiscard]]
+        const GridPathOptions& options() const noexcept
+        {
+            return options_;
+        }
+
+        /**
+         * @brief Allocates the buffers needed for grids of size @a size.
+         */
+        void reserve(const Size2D<size_t>& size)
+        {
+            const auto count = size.rows * size.columns;
+            if (count > size_t(std::numeric_limits<uint32_t>::max()))
+                CHORASMIA_THROW("The grid is too large.");
+            if (count <= cost_.size())
+                return;
+            cost_.resize(count);
+            parent_.resize(count);
+            seen_.resize(count);
+            closed_.resize(count);
+            heap_.reserve(count / 8);
+        }
+
+        /**
+         * @brief Finds the cheapest path from @a start to @a goal.
+         *
+         * On success the path, including both @a start and @a goal, is
+         * written to @a path and the function returns true. If no path
+         * exists, @a path is cleared and the function returns false.
+         */
+        template <typename T>
+        bool find_path(const ArrayView2D<T>& costs,
+                       const Index2D<uint32_t>& start,
+                       const Index2D<uint32_t>& goal,
+                       std::vector<Index2D<uint32_t>>& path)
+        {
+            path.clear();
+            path_cost_ = std::numeric_limits<float>::infinity();
+
+            if (start.row >= costs.row_count() || start.column >= costs.col_count()
+                || goal.row >= costs.row_count() || goal.column >= costs.col_count())
+            {
+                CHORASMIA_THROW("start or goal lies outside the grid.");
+            }
+
+            reserve(costs.dimensions());
+            next_generation();
+            rows_ = uint32_t(costs.row_count());
+            cols_ = uint32_t(costs.col_count());
+            goal_ = goal;
+
+            if (!is_passable(costs, start) || !is_passable(costs, goal))
+                return false;
+
+            heap_.clear();
+            const auto start_node = to_node(start);
+            const auto goal_node = to_node(goal);
+            relax(start_node, start_node, 0);
+
+            while (!heap_.empty())
+            {
+                const auto node = pop();
+                if (closed_[node] == generation_)
+                    continue;
+                closed_[node] = generation_;
+
+                if (node == goal_node)
+                {
+                    path_cost_ = cost_[node];
+                    make_path(start_node, goal_node, path);
+                    return true;
+                }
+
+                if (options_.algorithm == PathAlgorithm::JUMP_POINT_SEARCH)
+                    expand_jump_points(costs, node);
+                else
+                    expand_neighbors(costs, node);
+            }
+            return false;
+        }
+
+        /**
+         * @brief The cost of the path found by the most recent call to
+         *  find_path, or infinity if no path was found.
+         */
+        [[nodiscard]]
+        float path_cost() const noexcept
+        {
+            return path_cost_;
+        }
+
+    private:
+        struct HeapEntry
+        {
+            float priority;
+            uint32_t node;
+        };
+
+        static constexpr float SQRT2 = 1.41421356f;
+        static constexpr int DIRECTIONS[8][2] = {
+            {-1, 0}, {0, -1}, {0, 1}, {1, 0},
+            {-1, -1}, {-1, 1}, {1, -1}, {1, 1}
+        };
+
+        template <typename T>
+        [[nodiscard]]
+        static bool is_passable(const ArrayView2D<T>& costs,
+                                const Index2D<uint32_t>& index)
+        {
+            const auto cost = costs[{index.row, index.column}];
+            if constexpr (std::is_floating_point_v<T>)
+                return cost >= 0 && std::isfinite(cost);
+            else
+                return cost >= 0;
+        }
+
+        template <typename T>
+        [[nodiscard]]
+        bool is_passable(const ArrayView2D<T>& costs, int64_t row, int64_t col) const
+        {
+            return row >= 0 && col >= 0 && row < rows_ && col < cols_
+                   && is_passable(costs, Index2D<uint32_t>(uint32_t(row), uint32_t(col)));
+        }
+
+        [[nodiscard]]
+        uint32_t to_node(const Index2D<uint32_t>& index) const noexcept
+        {
+            return index.row * cols_ + index.column;
+        }
+
+        [[nodiscard]]
+        Index2D<uint32_t> to_index(uint32_t node) const noexcept
+        {
+            return {node / cols_, node % cols_};
+        }
+
+        void next_generation()
+        {
+            if (++generation_ == 0)
+            {
+                std::fill(seen_.begin(), seen_.end(), 0);
+                std::fill(closed_.begin(), closed_.end(), 0);
+                generation_ = 1;
+            }
+        }
+
+        [[nodiscard]]
+        float heuristic(const Index2D<uint32_t>& index) const noexcept
+        {
+            if (options_.algorithm == PathAlgorithm::DIJKSTRA)
+                return 0;
+            const auto dr = float(index.row > goal_.row ? index.row - goal_.row
+                                                        : goal_.row - index.row);
+            const auto dc = float(index.column > goal_.column ? index.column - goal_.column
+                                                              : goal_.column - index.column);
+            if (options_.neighborhood == GridNeighborhood::FOUR)
+                return (dr + dc) * options_.min_cost;
+            return (std::max(dr, dc) + (SQRT2 - 1) * std::min(dr, dc))
+                   * options_.min_cost;
+        }
+
+        void relax(uint32_t node, uint32_t parent, float cost)
+        {
+            if (seen_[node] == generation_ && cost_[node] <= cost)
+                return;
+            seen_[node] = generation_;
+            cost_[node] = cost;
+            parent_[node] = parent;
+            push({cost + heuristic(to_index(node)), node});
+        }
+
+        template <typename T>
+        void expand_neighbors(const ArrayView2D<T>& costs, uint32_t node)
+        {
+            const auto index = to_index(node);
+            const auto row = int64_t(index.row), col = int64_t(index.column);
+            const auto count = options_.neighborhood == GridNeighborhood::EIGHT ? 8 : 4;
+            for (int i = 0; i < count; ++i)
+            {
+                const auto dr = DIRECTIONS[i][0];
+                const auto dc = DIRECTIONS[i][1];
+                const auto r = row + dr, c = col + dc;
+                if (!is_passable(costs, r, c))
+                    continue;
+                if (dr != 0 && dc != 0
+                    && (!is_passable(costs, r, col) || !is_passable(costs, row, c)))
+                {
+                    continue;
+                }
+
+                const Index2D<uint32_t> next{uint32_t(r), uint32_t(c)};
+                const auto next_node = to_node(next);
+                if (closed_[next_node] == generation_)
+                    continue;
+                const auto step = dr != 0 && dc != 0 ? SQRT2 : 1.0f;
+                relax(next_node, node,
+                      cost_[node] + step * float(costs[{next.row, next.column}]));
+            }
+        }
+
+        template <typename T>
+        void expand_jump_points(const ArrayView2D<T>& costs, uint32_t node)
+        {
+            const auto index = to_index(node);
+            const auto parent = to_index(parent_[node]);
+            const auto row = int64_t(index.row), col = int64_t(index.column);
+            const auto prow = int64_t(parent.row), pcol = int64_t(parent.column);
+            const int dr = row > prow ? 1 : (row < prow ? -1 : 0);
+            const int dc = col > pcol ? 1 : (col < pcol ? -1 : 0);
+
+            auto try_direction = [&](int ddr, int ddc)
+            {
+                int64_t jr, jc;
+                if (!jump(costs, row, col, ddr, ddc, jr, jc))
+                    return;
+                const Index2D<uint32_t> next{uint32_t(jr), uint32_t(jc)};
+                const auto next_node = to_node(next);
+                if (closed_[next_node] == generation_)
+                    return;
+                const auto n = float(std::max(std::abs(jr - row), std::abs(jc - col)));
+                const auto step = ddr != 0 && ddc != 0 ? SQRT2 * n : n;
+                relax(next_node, node,
+                      cost_[node] + step * float(costs[{next.row, next.column}]));
+            };
+
+            if (dr == 0 && dc == 0)
+            {
+                for (const auto& d : DIRECTIONS)
+                {
+                    if (d[0] != 0 && d[1] != 0
+                        && (!is_passable(costs, row + d[0], col)
+                            || !is_passable(costs, row, col + d[1])))
+                    {
+                        continue;
+                    }
+                    try_direction(d[0], d[1]);
+                }
+            }
+            else if (dr != 0 && dc != 0)
+            {
+                const auto vertical = is_passable(costs, row + dr, col);
+                const auto horizontal = is_passable(costs, row, col + dc);
+                if (vertical)
+                    try_direction(dr, 0);
+                if (horizontal)
+                    try_direction(0, dc);
+                if (vertical && horizontal)
+                    try_direction(dr, dc);
+            }
+            else
+            {
+                // Moving straight. (sr, sc) is perpendicular to (dr, dc).
+                const int sr = dc, sc = dr;
+                const auto next = is_passable(costs, row + dr, col + dc);
+                const auto left = is_passable(costs, row + sr, col + sc);
+                const auto right = is_passable(costs, row - sr, col - sc);
+                if (next)
+                {
+                    try_direction(dr, dc);
+                    if (left)
+                        try_direction(dr + sr, dc + sc);
+                    if (right)
+                        try_direction(dr - sr, dc - sc);
+                }
+                if (left)
+                    try_direction(sr, sc);
+                if (right)
+                    try_direction(-sr, -sc);
+            }
+        }
+
+        // Moves from (row, col) in direction (dr, dc) until it finds a
+        // jump point, i.e. the goal or a cell with a forced neighbor.
+        template <typename T>
+        bool jump(const ArrayView2D<T>& costs, int64_t row, int64_t col,
+                  int dr, int dc, int64_t& jump_row, int64_t& jump_col) const
+        {
+            int64_t r = row + dr, c = col + dc;
+            while (is_passable(costs, r, c))
+            {
+                if (r == goal_.row && c == goal_.column)
+                    break;
+
+                if (dr != 0 && dc != 0)
+                {
+                    int64_t tmp_r, tmp_c;
+                    if (jump(costs, r, c, dr, 0, tmp_r, tmp_c)
+                        || jump(costs, r, c, 0, dc, tmp_r, tmp_c))
+                    {
+                        break;
+                    }
+                    if (!is_passable(costs, r + dr, c) || !is_passable(costs, r, c + dc))
+                        return false;
+                }
+                else if (dc != 0)
+                {
+                    if ((is_passable(costs, r - 1, c) && !is_passable(costs, r - 1, c - dc))
+                        || (is_passable(costs, r + 1, c) && !is_passable(costs, r + 1, c - dc)))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    if ((is_passable(costs, r, c - 1) && !is_passable(costs, r - dr, c - 1))
+                        || (is_passable(costs, r, c + 1) && !is_passable(costs, r - dr, c + 1)))
+                    {
+                        break;
+                    }
+                }
+                r += dr;
+                c += dc;
+            }
+
+            if (!is_passable(costs, r, c))
+                return false;
+            jump_row = r;
+            jump_col = c;
+            return true;
+        }
+
+        void make_path(uint32_t start_node, uint32_t goal_node,
+                       std::vector<Index2D<uint32_t>>& path) const
+        {
+            auto node = goal_node;
+            path.push_back(to_index(node));
+            while (node != start_node)
+            {
+                const auto to = to_index(node);
+                const auto from = to_index(parent_[node]);
+                // Fill in the cells between jump points.
+                auto r = int64_t(to.row), c = int64_t(to.column);
+                const int dr = from.row > to.row ? 1 : (from.row < to.row ? -1 : 0);
+                const int dc = from.column > to.column ? 1 : (from.column < to.column ? -1 : 0);
+                while (true)
+                {
+                    r += dr;
+                    c += dc;
+                    path.emplace_back(uint32_t(r), uint32_t(c));
+                    if (r == from.row && c == from.column)
+                        break;
+                }
+                node = parent_[node];
+            }
+            std::reverse(path.begin(), path.end());
+        }
+
+        // A 4-ary min-heap, which is shallower and more cache friendly
+        // than a binary heap.
+        void push(HeapEntry entry)
+        {
+            auto i = heap_.size();
+            heap_.push_back(entry);
+            while (i != 0)
+            {
+                const auto parent = (i - 1) / 4;
+                if (heap_[parent].priority <= entry.priority)
+                    break;
+                heap_[i] = heap_[parent];
+                i = parent;
+            }
+            heap_[i] = entry;
+        }
+
+        uint32_t pop()
+        {
+            const auto result = heap_.front().node;
+            const auto last = heap_.back();
+            heap_.pop_back();
+            const auto n = heap_.size();
+            if (n == 0)
+                return result;
+
+            size_t i = 0;
+            while (true)
+            {
+                const auto first_child = 4 * i + 1;
+                if (first_child >= n)
+                    break;
+                auto best = first_child;
+                const auto end_child = std::min(first_child + 4, n);
+                for (auto child = first_child + 1; child < end_child; ++child)
+                {
+                    if (heap_[child].priority < heap_[best].priority)
+                        best = child;
+                }
+                if (last.priority <= heap_[best].priority)
+                    break;
+                heap_[i] = heap_[best];
+                i = best;
+            }
+            heap_[i] = last;
+            return result;
+        }
+
+        GridPathOptions options_;
+        std::vector<float> cost_;
+        std::vector<uint32_t> parent_;
+        std::vector<uint32_t> seen_;
+        std::vector<uint32_t> closed_;
+        std::vector<HeapEntry> heap_;
+        uint32_t generation_ = 0;
+        uint32_t rows_ = 0;
+        uint32_t cols_ = 0;
+        Index2D<uint32_t> goal_;
+        float path_cost_ = std::numeric_limits<float>::infinity();
+    };
+}
@@ -0,0 +1,291 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include "Index2D.hpp"
+#include "Point2D.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief Iterates over the cells of a 2D array that are crossed by
+     *  a line segment, using the Amanatides-Woo traversal algorithm.
+     *
+     * Cells are visited in order from the start of the segment to the
+     * end, and consecutive cells always share an edge. The segment is
+     * clipped to the array before the traversal starts.
+     *
+     * t_entry() and t_exit() return where the segment enters and leaves
+     * the current cell, as fractions of the full (unclipped) segment
+     * from 0 to 1.
+     */
+    class GridRayIterator
+    {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Index2D<size_t>;
+        using difference_type = ptrdiff_t;
+        using reference = Index2D<size_t>;
+        using pointer = void;
+
+        GridRayIterator() = default;
+
+        GridRayIterator(const Point2D<double>& from,
+                        const Point2D<double>& to,
+                        const Size2D<size_t>& size) noexcept
+        {
+            if (is_empty(size))
+                return;
+
+            const auto rows = double(size.rows);
+            const auto cols = double(size.columns);
+            const auto dr = to.row - from.row;
+            const auto dc = to.column - from.column;
+
+            // Liang-Barsky clipping against [0, rows] x [0, cols].
+            double t0 = 0, t1 = 1;
+            if (!clip(-dr, from.row, t0, t1)
+                || !clip(dr, rows - from.row, t0, t1)
+                || !clip(-dc, from.column, t0, t1)
+                || !clip(dc, cols - from.column, t0, t1))
+            {
+                return;
+            }
+
+            const auto [row, end_row] = get_first_and_last(
+                from.row + t0 * dr, from.row + t1 * dr, dr, size.rows);
+            const auto [col, end_col] = get_first_and_last(
+                from.column + t0 * dc, from.column + t1 * dc, dc, size.columns);
+
+            row_ = row;
+            col_ = col;
+            end_row_ = end_row;
+            end_col_ = end_col;
+            step_row_ = dr > 0 ? 1 : (dr < 0 ? -1 : 0);
+            step_col_ = dc > 0 ? 1 : (dc < 0 ? -1 : 0);
+            t_delta_row_ = dr != 0 ? 1.0 / std::abs(dr) : INF;
+            t_delta_col_ = dc != 0 ? 1.0 / std::abs(dc) : INF;
+            t_max_row_ = get_first_crossing(from.row, dr, row_, step_row_);
+            t_max_col_ = get_first_crossing(from.column, dc, col_, step_col_);
+            t_entry_ = t0;
+            t_end_ = t1;
+            remaining_ = size_t(std::abs(end_row_ - row_)
+                                + std::abs(end_col_ - col_) + 1);
+        }
+
+        [[nodiscard]]
+        Index2D<size_t> operator*() const noexcept
+        {
+            return {size_t(row_), size_t(col_)};
+        }
+
+        GridRayIterator& operator++() noexcept
+        {
+            if (--remaining_ == 0)
+                return *this;
+
+            // Prefer the axis whose boundary is crossed first, but never
+            // step past the last row or column.
+            if (col_ == end_col_
+                || (row_ != end_row_ && t_max_row_ < t_max_col_))
+            {
+                t_entry_ = t_max_row_;
+                row_ += step_row_;
+                t_max_row_ += t_delta_row_;
+            }
+            else
+            {
+                t_entry_ = t_max_col_;
+                col_ += step_col_;
+                t_max_col_ += t_delta_col_;
+            }
+            return *this;
+        }
+
+        GridRayIterator operator++(int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        /**
+         * @brief Where the segment enters the current cell.
+         */
+        [[nodiscard]]
+        double t_entry() const noexcept
+        {
+            return t_entry_;
+        }
+
+        /**
+         * @brief Where the segment leaves the current cell.
+         */
+        [[nodiscard]]
+        double t_exit() const noexcept
+        {
+            if (remaining_ <= 1)
+                return t_end_;
+            return std::clamp(std::min(t_max_row_, t_max_col_),
+                              t_entry_, t_end_);
+        }
+
+        /**
+         * @brief The number of cells left, including the current one.
+         */
+        [[nodiscard]]
+        size_t remaining() const noexcept
+        {
+            return remaining_;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const GridRayIterator& a,
+                               const GridRayIterator& b) noexcept
+        {
+            return a.remaining_ == b.remaining_
+                   && (a.remaining_ == 0
+                       || (a.row_ == b.row_ && a.col_ == b.col_));
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const GridRayIterator& it,
+                               std::default_sentinel_t) noexcept
+        {
+            return it.remaining_ == 0;
+        }
+
+    private:
+        static constexpr double INF = std::numeric_limits<double>::infinity();
+
+        // Shrinks [t0, t1] to the part of the segment where p * t <= q.
+        static bool clip(double p, double q, double& t0, double& t1) noexcept
+        {
+            if (p == 0)
+                return q >= 0;
+            const auto t = q / p;
+            if (p < 0)
+            {
+                if (t > t1)
+                    return false;
+                t0 = std::max(t0, t);
+            }
+            else
+            {
+                if (t < t0)
+                    return false;
+                t1 = std::min(t1, t);
+            }
+            return t0 <= t1;
+        }
+
+        // A coordinate that lies exactly on a cell boundary belongs to
+        // the cell on the side the segment is moving towards.
+        static std::pair<ptrdiff_t, ptrdiff_t>
+        get_first_and_last(double first, double last, double delta, size_t count)
+        {
+            const auto max = ptrdiff_t(count) - 1;
+            auto first_index = ptrdiff_t(std::floor(first));
+            auto last_index = ptrdiff_t(std::floor(last));
+            if (delta < 0 && double(first_index) == first)
+                --first_index;
+            if (delta > 0 && double(last_index) == last)
+                --last_index;
+            first_index = std::clamp<ptrdiff_t>(first_index, 0, max);
+            last_index = std::clamp<ptrdiff_t>(last_index, 0, max);
+            if (delta > 0 && last_index < first_index)
+                last_index = first_index;
+            else if (delta < 0 && last_index > first_index)
+                last_index = first_index;
+            return {first_index, last_index};
+        }
+
+        static double get_first_crossing(double origin, double delta,
+                                         ptrdiff_t index, ptrdiff_t step) noexcept
+        {
+            if (step > 0)
+                return (double(index + 1) - origin) / delta;
+            if (step < 0)
+                return (double(index) - origin) / delta;
+            return INF;
+        }
+
+        ptrdiff_t row_ = 0;
+        ptrdiff_t col_ = 0;
+        ptrdiff_t end_row_ = 0;
+        ptrdiff_t end_col_ = 0;
+        ptrdiff_t step_row_ = 0;
+        ptrdiff_t step_col_ = 0;
+        double t_max_row_ = INF;
+        double t_max_col_ = INF;
+        double t_delta_row_ = INF;
+        double t_delta_col_ = INF;
+        double t_entry_ = 0;
+        double t_end_ = 0;
+        size_t remaining_ = 0;
+    };
+
+    /**
+     * @brief A range with the cells of a 2D array with dimensions
+     *  @a size that are crossed by the line segment from @a from to
+     *  @a to.
+     */
+    class GridRay
+    {
+    public:
+        GridRay() = default;
+
+        GridRay(const Point2D<double>& from,
+                const Point2D<double>& to,
+                const Size2D<size_t>& size) noexcept
+            : begin_(from, to, size)
+        {}
+
+        [[nodiscard]]
+        GridRayIterator begin() const noexcept
+        {
+            return begin_;
+        }
+
+        [[nodiscard]]
+        std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            return begin_.remaining();
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return begin_.remaining() == 0;
+        }
+
+    private:
+        GridRayIterator begin_;
+    };
+
+    /**
+     * @brief Returns the center of the cell at @a index.
+     */
+    [[nodiscard]]
+    constexpr Point2D<double> get_center(const Index2D<size_t>& index) noexcept
+    {
+        return {double(index.row) + 0.5, double(index.column) + 0.5};
+    }
+}
@@ -6,9 +6,16 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <queue>
+#include <ranges>
+#include <span>
+#include <type_traits>
 #include <vector>
+#include "ChorasmiaException.hpp"
+#include "ParallelFor.hpp"
 
 namespace Chorasmia
 {
@@ -21,6 +28,27 @@ namespace Chorasmia
             return {};
     }
 
+    namespace Detail
+    {
+        template <typename Key>
+        constexpr bool are_interval_keys_equal(Key a, Key b, Key margin)
+        {
+            if constexpr (std::is_floating_point_v<Key>)
+                return std::abs(b - a) < margin;
+            else
+                return a == b;
+        }
+
+        template <typename Key>
+        constexpr bool is_interval_key_less(Key a, Key b, Key margin)
+        {
+            if constexpr (std::is_floating_point_v<Key>)
+                return b - a > margin;
+            else
+                return a < b;
+        }
+    }
+
     template <typename Key, typename Value>
     class IntervalMap
     {
@@ -42,6 +70,12 @@ namespace Chorasmia
             return map_.data();
         }
 
+        [[nodiscard]]
+        Key margin() const
+        {
+            return margin_;
+        }
+
         [[nodiscard]]
         size_t size() const
         {
@@ -54,6 +88,46 @@ namespace Chorasmia
             return begin() + find_impl(key);
         }
 
+        /**
+         * @brief Looks up all of @a keys and stores the result of find
+         *  for each of them in @a results.
+         *
+         * If @a keys are sorted, the lookups walk forward through the map
+         * with exponential searches from the previous result. Otherwise
+         * the keys are looked up in groups, with the binary searches for
+         * all the keys in a group proceeding in lockstep, so the memory
+         * accesses of one search overlap those of the others.
+         */
+        void find_many(std::span<const Key> keys, std::span<Iterator> results) const
+        {
+            find_many_impl(keys, results);
+        }
+
+        /**
+         * @brief Looks up all of @a keys and stores the value of the
+         *  interval that contains each of them in @a results.
+         */
+        void find_many(std::span<const Key> keys, std::span<Value> results) const
+        {
+            find_many_impl(keys, results);
+        }
+
+        /**
+         * @brief Splits @a keys into chunks that are looked up on
+         *  separate threads.
+         */
+        void find_many(ParallelPolicy policy, std::span<const Key> keys,
+                       std::span<Iterator> results) const
+        {
+            find_many_parallel(policy, keys, results);
+        }
+
+        void find_many(ParallelPolicy policy, std::span<const Key> keys,
+                       std::span<Value> results) const
+        {
+            find_many_parallel(policy, keys, results);
+        }
+
         void insert(Key key, Value value)
         {
             auto pos = find_impl(key);
@@ -111,6 +185,99 @@ namespace Chorasmia
             }
         }
 
+        /**
+         * @brief Replaces the contents of the map with @a intervals.
+         *
+         * Each element in @a intervals is a (from, to, value) tuple or
+         * a struct with three members. The result is the same as calling
+         * insert(from, to, value) for each of them, in order, on a map
+         * that only contains its first value (normally the default value
+         * it was constructed with), i.e. later intervals
+         * override earlier ones where they overlap.
+         *
+         * The intervals are sorted and swept once, so the cost is
+         * O(n log n) rather than the O(n²) of sequential inserts. With
+         * floating point keys, the result is only guaranteed to be the
+         * same if no two different end points are within the margin of
+         * each other.
+         */
+        template <std::ranges::input_range R>
+        void assign(R&& intervals)
+        {
+            std::vector<Value> values;
+            // The start point and index of each interval, and the end
+            // points in the same order as values.
+            std::vector<std::pair<Key, size_t>> starts;
+            std::vector<Key> ends;
+            for (auto&& interval : intervals)
+            {
+                auto&& [from, to, value] = interval;
+                Key a = from, b = to;
+                if (a > b)
+                    std::swap(a, b);
+                else if (a == b)
+                    continue;
+                starts.emplace_back(a, values.size());
+                ends.push_back(b);
+                values.emplace_back(value);
+            }
+
+            std::vector<Key> points;
+            points.reserve(2 * starts.size());
+            for (size_t i = 0; i < starts.size(); ++i)
+            {
+                points.push_back(starts[i].first);
+                points.push_back(ends[i]);
+            }
+            std::ranges::sort(points);
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+            std::ranges::sort(starts);
+
+            // Sweep the points from left to right with a max-heap of the
+            // intervals that have started, where the most recent one is
+            // on top. Intervals that have ended are removed lazily when
+            // they reach the top.
+            constexpr auto NONE = std::numeric_limits<size_t>::max();
+            std::priority_queue<size_t> active;
+            std::vector<std::pair<Key, size_t>> boundaries;
+            boundaries.reserve(points.size());
+            size_t current = NONE;
+            auto next_start = starts.begin();
+            for (const auto& point : points)
+            {
+                for (; next_start != starts.end() && next_start->first == point; ++next_start)
+                    active.push(next_start->second);
+                while (!active.empty() && !(point < ends[active.top()]))
+                    active.pop();
+
+                const auto winner = active.empty() ? NONE : active.top();
+                if (winner != current)
+                {
+                    boundaries.emplace_back(point, winner);
+                    current = winner;
+                }
+            }
+
+            constexpr auto LOWEST = std::numeric_limits<Key>::lowest();
+            constexpr auto MAX = std::numeric_limits<Key>::max();
+            const auto default_value = map_.front().second;
+            Map map;
+            map.reserve(boundaries.size() + 2);
+            map.emplace_back(LOWEST, default_value);
+            for (const auto& [key, index] : boundaries)
+            {
+                if (!(key < MAX))
+                    break;
+                const auto& value = index == NONE ? default_value : values[index];
+                if (key == LOWEST)
+                    map.front().second = value;
+                else
+                    map.emplace_back(key, value);
+            }
+            map.emplace_back(MAX, Value());
+            map_ = std::move(map);
+        }
+
         [[nodiscard]]
         Iterator begin() const
         {
@@ -126,19 +293,13 @@ namespace Chorasmia
         [[nodiscard]]
         constexpr bool are_equal(Key a, Key b) const
         {
-            if constexpr (std::is_floating_point_v<Key>)
-                return std::abs(b - a) < margin_;
-            else
-                return a == b;
+            return Detail::are_interval_keys_equal(a, b, margin_);
         }
 
         [[nodiscard]]
         constexpr bool is_less(Key a, Key b) const
         {
-            if constexpr (std::is_floating_point_v<Key>)
-                return b - a > margin_;
-            else
-                return a < b;
+            return Detail::is_interval_key_less(a, b, margin_);
         }
 
         [[nodiscard]]
@@ -156,6 +317,106 @@ namespace Chorasmia
             return first;
         }
 
+        template <typename Out>
+        void store(Out& out, size_t pos) const
+        {
+            if constexpr (std::is_same_v<Out, Iterator>)
+                out = begin() + ptrdiff_t(pos);
+            else
+                out = map_[pos].second;
+        }
+
+        template <typename Out>
+        void find_many_impl(std::span<const Key> keys, std::span<Out> results) const
+        {
+            if (results.size() < keys.size())
+                CHORASMIA_THROW("results is smaller than keys.");
+
+            if (std::is_sorted(keys.begin(), keys.end()))
+                find_sorted(keys, results);
+            else
+                find_interleaved(keys, results);
+        }
+
+        template <typename Out>
+        void find_sorted(std::span<const Key> keys, std::span<Out> results) const
+        {
+            const auto size = map_.size();
+            size_t pos = 0;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                const auto key = keys[i];
+                size_t step = 1;
+                while (pos + step < size && !is_less(key, map_[pos + step].first))
+                {
+                    pos += step;
+                    step *= 2;
+                }
+
+                size_t last = std::min(pos + step, size);
+                while (last - pos > 1)
+                {
+                    auto m = pos + (last - pos) / 2;
+                    if (is_less(key, map_[m].first))
+                        last = m;
+                    else
+                        pos = m;
+                }
+                store(results[i], pos);
+            }
+        }
+
+        template <typename Out>
+        void find_interleaved(std::span<const Key> keys, std::span<Out> results) const
+        {
+            constexpr size_t GROUP_SIZE = 16;
+            const auto* map = map_.data();
+            size_t i = 0;
+            for (; i + GROUP_SIZE <= keys.size(); i += GROUP_SIZE)
+            {
+                const auto* group = keys.data() + i;
+                size_t first[GROUP_SIZE] = {};
+                // All the searches have the same length, and the result
+                // is in [first[j], first[j] + len) for each key.
+                for (auto len = map_.size(); len > 1;)
+                {
+                    const auto half = len / 2;
+                    len -= half;
+                    for (size_t j = 0; j < GROUP_SIZE; ++j)
+                    {
+                        const bool right = !is_less(group[j], map[first[j] + half].first);
+                        first[j] += right ? half : 0;
+#if defined(__GNUC__)
+                        __builtin_prefetch(map + first[j] + len / 2);
+#endif
+                    }
+                }
+
+                for (size_t j = 0; j < GROUP_SIZE; ++j)
+                    store(results[i + j], first[j]);
+            }
+
+            for (; i < keys.size(); ++i)
+                store(results[i], find_impl(keys[i]));
+        }
+
+        template <typename Out>
+        void find_many_parallel(ParallelPolicy policy, std::span<const Key> keys,
+                                std::span<Out> results) const
+        {
+            if (results.size() < keys.size())
+                CHORASMIA_THROW("results is smaller than keys.");
+
+            constexpr size_t MIN_KEYS_PER_THREAD = 64 * 1024;
+            parallel_for(keys.size(), [&](size_t first, size_t last)
+                {
+                    find_many_impl(keys.subspan(first, last - first),
+                                   results.subspan(first, last - first));
+                },
+                MIN_KEYS_PER_THREAD,
+                policy.thread_count);
+        }
+
         std::vector<std::pair<Key, Value>> map_;
         Key margin_;
     };
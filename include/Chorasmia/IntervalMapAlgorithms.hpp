@@ -0,0 +1,116 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "ArrayView2DAlgorithms.hpp"
+#include "FrozenIntervalMap.hpp"
+#include "IntervalMap.hpp"
+
+namespace Chorasmia
+{
+    namespace Detail
+    {
+        // Keys with at most 65536 different values are classified with
+        // a table that has an entry for every one of them.
+        template <typename Key>
+        constexpr bool USE_CLASSIFICATION_TABLE = std::is_integral_v<Key>
+                                                  && !std::is_same_v<Key, bool>
+                                                  && sizeof(Key) <= 2;
+
+        // The table is an array rather than a std::vector, since
+        // find_many needs a std::span, and std::vector<bool> can't
+        // provide one.
+        template <typename Key, typename Value>
+        std::unique_ptr<Value[]> make_classification_table(const IntervalMap<Key, Value>& map)
+        {
+            constexpr auto MIN = std::numeric_limits<Key>::min();
+            constexpr auto MAX = std::numeric_limits<Key>::max();
+            std::vector<Key> keys;
+            keys.reserve(size_t(MAX - MIN) + 1);
+            for (int key = MIN; key <= MAX; ++key)
+                keys.push_back(Key(key));
+
+            auto table = std::make_unique<Value[]>(keys.size());
+            map.find_many(keys, std::span<Value>(table.get(), keys.size()));
+            return table;
+        }
+
+        template <typename Key>
+        size_t get_table_index(Key key)
+        {
+            return size_t(int(key) - int(std::numeric_limits<Key>::min()));
+        }
+
+        template <typename Key, typename Value, typename TransformFunc>
+        void classify(const ArrayView2D<Key>& src,
+                      const IntervalMap<Key, Value>& map,
+                      const MutableArrayView2D<Value>& dst,
+                      TransformFunc transform_func)
+        {
+            if (src.dimensions() != dst.dimensions())
+                CHORASMIA_THROW("dst has incorrect dimensions.");
+
+            if constexpr (USE_CLASSIFICATION_TABLE<Key>)
+            {
+                const auto table = make_classification_table(map);
+                transform_func(src, dst, [&](Key key)
+                {
+                    return table[get_table_index(key)];
+                });
+            }
+            else
+            {
+                const FrozenIntervalMap frozen(map);
+                transform_func(src, dst, [&](Key key)
+                {
+                    return frozen.find(key);
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns the value of the interval in @a map that contains
+     *  src[i, j] to dst[i, j] for every value in @a src.
+     *
+     * For 8- and 16-bit integer keys, the map is first expanded to a
+     * table with the value for every possible key, so each value in
+     * @a src costs a single load. For other keys, the map is converted
+     * to a FrozenIntervalMap, whose searches only touch keys and don't
+     * branch.
+     */
+    template <typename Key, typename Value>
+    void classify(const ArrayView2D<Key>& src,
+                  const IntervalMap<Key, Value>& map,
+                  const MutableArrayView2D<Value>& dst)
+    {
+        Detail::classify(src, map, dst, [](auto& s, auto& d, auto func)
+        {
+            transform(s, d, func);
+        });
+    }
+
+    /**
+     * @brief Multi-threaded version of classify(src, map, dst).
+     */
+    template <typename Key, typename Value>
+    void classify(ParallelPolicy policy,
+                  const ArrayView2D<Key>& src,
+                  const IntervalMap<Key, Value>& map,
+                  const MutableArrayView2D<Value>& dst)
+    {
+        Detail::classify(src, map, dst, [&](auto& s, auto& d, auto func)
+        {
+            transform(policy, s, d, func);
+        });
+    }
+}
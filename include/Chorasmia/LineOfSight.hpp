@@ -0,0 +1,186 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include "GridRay.hpp"
+#include "MutableArrayView2D.hpp"
+#include "ParallelFor.hpp"
+
+namespace Chorasmia
+{
+    struct SightLine
+    {
+        Index2D<size_t> from;
+        Index2D<size_t> to;
+    };
+
+    namespace Detail
+    {
+        inline void assert_in_array(const Index2D<size_t>& index,
+                                    const Size2D<size_t>& size)
+        {
+            if (index.row >= size.rows || index.column >= size.columns)
+                CHORASMIA_THROW("Index lies outside the array.");
+        }
+    }
+
+    /**
+     * @brief Returns true if the terrain in @a heights doesn't block the
+     *  line of sight between the cells @a from and @a to.
+     *
+     * The terrain height in a cell is the value in @a heights. The line
+     * of sight goes from @a observer_height above the center of @a from
+     * to @a target_height above the center of @a to, and it is blocked
+     * if the terrain is higher than the line in any of the cells it
+     * crosses.
+     */
+    template <typename T>
+    [[nodiscard]]
+    bool has_line_of_sight(const ArrayView2D<T>& heights,
+                           const Index2D<size_t>& from,
+                           const Index2D<size_t>& to,
+                           double observer_height = 0,
+                           double target_height = 0)
+    {
+        Detail::assert_in_array(from, heights.dimensions());
+        Detail::assert_in_array(to, heights.dimensions());
+
+        const auto eye = double(heights[from]) + observer_height;
+        const auto target = double(heights[to]) + target_height;
+        GridRay ray(get_center(from), get_center(to), heights.dimensions());
+        auto it = ray.begin();
+        if (it == ray.end())
+            return true;
+
+        for (++it; it.remaining() > 1; ++it)
+        {
+            const auto t = (it.t_entry() + it.t_exit()) * 0.5;
+            if (double(heights[*it]) > eye + (target - eye) * t)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks a batch of lines of sight, distributing them over
+     *  up to @a thread_count threads.
+     *
+     * The result for @a lines[i] is written to @a results[i].
+     * @see has_line_of_sight
+     */
+    template <typename T>
+    void check_lines_of_sight(const ArrayView2D<T>& heights,
+                              std::span<const SightLine> lines,
+                              std::span<bool> results,
+                              double observer_height = 0,
+                              double target_height = 0,
+                              unsigned thread_count = 0)
+    {
+        if (results.size() < lines.size())
+            CHORASMIA_THROW("results is smaller than lines.");
+
+        for (const auto& line : lines)
+        {
+            Detail::assert_in_array(line.from, heights.dimensions());
+            Detail::assert_in_array(line.to, heights.dimensions());
+        }
+
+        parallel_for(lines.size(), [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    results[i] = has_line_of_sight(heights,
+                                                   lines[i].from, lines[i].to,
+                                                   observer_height,
+                                                   target_height);
+                }
+            },
+            64, thread_count);
+    }
+
+    /**
+     * @brief Computes which cells in @a heights are visible from
+     *  @a observer_height above the center of @a observer.
+     *
+     * Visible cells are set to 1 in @a visible, all other cells are set
+     * to 0. A cell is visible if a point @a target_height above its
+     * center can be seen.
+     *
+     * The computation is an R2 approximation: rays are cast from the
+     * observer to every cell on the border of the array, and the cells
+     * along each ray are classified as the ray passes through them.
+     * The rays are distributed over up to @a thread_count threads.
+     */
+    template <typename T>
+    void compute_viewshed(const ArrayView2D<T>& heights,
+                          const Index2D<size_t>& observer,
+                          double observer_height,
+                          const MutableArrayView2D<uint8_t>& visible,
+                          double target_height = 0,
+                          unsigned thread_count = 0)
+    {
+        const auto size = heights.dimensions();
+        if (visible.dimensions() != size)
+            CHORASMIA_THROW("visible has incorrect dimensions.");
+        Detail::assert_in_array(observer, size);
+
+        for (size_t i = 0; i < visible.row_count(); ++i)
+        {
+            auto row = visible.row(i);
+            std::fill(row.begin(), row.end(), uint8_t(0));
+        }
+        visible[observer] = 1;
+
+        std::vector<Index2D<size_t>> targets;
+        for (size_t j = 0; j < size.columns; ++j)
+        {
+            targets.emplace_back(0, j);
+            if (size.rows > 1)
+                targets.emplace_back(size.rows - 1, j);
+        }
+        for (size_t i = 1; i + 1 < size.rows; ++i)
+        {
+            targets.emplace_back(i, 0);
+            if (size.columns > 1)
+                targets.emplace_back(i, size.columns - 1);
+        }
+
+        const auto eye = double(heights[observer]) + observer_height;
+        const auto origin = get_center(observer);
+
+        parallel_for(targets.size(), [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    const auto end = get_center(targets[i]);
+                    const auto length = std::hypot(end.row - origin.row,
+                                                   end.column - origin.column);
+                    if (length == 0)
+                        continue;
+
+                    GridRay ray(origin, end, size);
+                    auto it = ray.begin();
+                    auto max_slope = -std::numeric_limits<double>::infinity();
+                    for (++it; it != ray.end(); ++it)
+                    {
+                        const auto distance = (it.t_entry() + it.t_exit())
+                                              * 0.5 * length;
+                        const auto height = double(heights[*it]) - eye;
+                        if ((height + target_height) / distance >= max_slope)
+                            std::atomic_ref(visible[*it]).store(1, std::memory_order_relaxed);
+                        max_slope = std::max(max_slope, height / distance);
+                    }
+                }
+            },
+            16, thread_count);
+    }
+}
@@ -0,0 +1,142 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <array>
+#include <concepts>
+#include <string>
+#include <type_traits>
+#include "MutableArrayView2D.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief Satisfied by std::mdspan with rank 2 and the default
+     *  accessor, and by other types with the same interface (e.g. the
+     *  reference implementation in std::experimental).
+     */
+    template <typename M>
+    concept Mdspan2D = requires(const M& m, size_t r)
+        {
+            typename M::element_type;
+            {M::rank()} -> std::convertible_to<size_t>;
+            {m.extent(r)} -> std::convertible_to<size_t>;
+            {m.stride(r)} -> std::convertible_to<size_t>;
+            {m.data_handle()} -> std::convertible_to<typename M::element_type*>;
+        }
+        && (M::rank() == 2);
+
+    /**
+     * @brief Satisfied by rank 2 mdspan types whose mapping can be
+     *  created from the extents and an array with the stride of each
+     *  dimension, e.g. std::mdspan with std::layout_stride.
+     */
+    template <typename M>
+    concept StridedMdspan2D = Mdspan2D<M>
+        && std::constructible_from<typename M::extents_type, size_t, size_t>
+        && std::constructible_from<typename M::mapping_type,
+                                   typename M::extents_type,
+                                   std::array<size_t, 2>>;
+
+    namespace Detail
+    {
+        template <Mdspan2D M>
+        size_t get_row_gap(const M& m)
+        {
+            if (m.extent(1) > 1 && m.stride(1) != 1)
+                CHORASMIA_THROW("mdspan's columns are not contiguous.");
+            if (m.extent(0) <= 1)
+                return 0;
+            if (size_t(m.stride(0)) < size_t(m.extent(1)))
+            {
+                CHORASMIA_THROW("mdspan's rows overlap or are not in"
+                                " row-major order. Row stride: "
+                                + std::to_string(m.stride(0)));
+            }
+            return size_t(m.stride(0)) - size_t(m.extent(1));
+        }
+
+        template <StridedMdspan2D M, typename Pointer, typename View>
+        M make_mdspan(Pointer data, const View& view)
+        {
+            using Extents = typename M::extents_type;
+            const std::array<size_t, 2> strides{view.col_count() + view.row_gap(), 1};
+            return M(data, typename M::mapping_type(
+                Extents(view.row_count(), view.col_count()), strides));
+        }
+    }
+
+    /**
+     * @brief Returns an ArrayView2D that refers to the same values as
+     *  @a m.
+     *
+     * @a m must have a row-major layout with unit column stride, i.e.
+     * layout_right or a compatible layout_stride. The row stride may
+     * be larger than the number of columns.
+     * @throw ChorasmiaException if the layout is incompatible.
+     */
+    template <Mdspan2D M>
+    [[nodiscard]]
+    auto make_array_view_2d(const M& m)
+    {
+        using T = std::remove_const_t<typename M::element_type>;
+        const auto row_gap = Detail::get_row_gap(m);
+        return ArrayView2D<T>(m.data_handle(),
+                              {size_t(m.extent(0)), size_t(m.extent(1))},
+                              row_gap);
+    }
+
+    /**
+     * @brief Returns a MutableArrayView2D that refers to the same
+     *  values as @a m.
+     *
+     * @see make_array_view_2d
+     */
+    template <Mdspan2D M>
+        requires (!std::is_const_v<typename M::element_type>)
+    [[nodiscard]]
+    auto make_mutable_array_view_2d(const M& m)
+    {
+        using T = typename M::element_type;
+        const auto row_gap = Detail::get_row_gap(m);
+        return MutableArrayView2D<T>(m.data_handle(),
+                                     {size_t(m.extent(0)), size_t(m.extent(1))},
+                                     row_gap);
+    }
+
+    /**
+     * @brief Returns an mdspan of type @a M that refers to the same
+     *  values as @a view.
+     *
+     * @a M is typically
+     * std::mdspan<const T, std::dextents<size_t, 2>, std::layout_stride>.
+     * Its mapping is created from the view's extents and the strides
+     * {col_count() + row_gap(), 1}. Chorasmia doesn't include <mdspan>
+     * itself, so any type with std::mdspan's constructors will do.
+     */
+    template <StridedMdspan2D M, typename T>
+        requires std::constructible_from<M, const T*, typename M::mapping_type>
+    [[nodiscard]]
+    M to_mdspan(const ArrayView2D<T>& view)
+    {
+        return Detail::make_mdspan<M>(view.data(), view);
+    }
+
+    /**
+     * @brief Returns an mdspan of type @a M that refers to the same
+     *  values as @a view.
+     *
+     * @see to_mdspan(const ArrayView2D<T>&)
+     */
+    template <StridedMdspan2D M, typename T>
+        requires std::constructible_from<M, T*, typename M::mapping_type>
+    [[nodiscard]]
+    M to_mdspan(const MutableArrayView2D<T>& view)
+    {
+        return Detail::make_mdspan<M>(view.data(), view);
+    }
+}
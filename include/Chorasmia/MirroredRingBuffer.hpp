@@ -0,0 +1,322 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "ChorasmiaException.hpp"
+
+namespace Chorasmia
+{
+    namespace Detail
+    {
+        [[noreturn]]
+        inline void throw_system_error(const char* function)
+        {
+            CHORASMIA_THROW("Call to " + std::string(function) + " failed: "
+                            + std::strerror(errno));
+        }
+
+        // Maps the same memory twice, back to back, and returns the
+        // address of the first mapping.
+        inline std::byte* map_mirrored_memory(size_t size)
+        {
+            const int fd = memfd_create("Chorasmia::MirroredRingBuffer", MFD_CLOEXEC);
+            if (fd == -1)
+                throw_system_error("memfd_create");
+
+            if (ftruncate(fd, off_t(size)) == -1)
+            {
+                close(fd);
+                throw_system_error("ftruncate");
+            }
+
+            // Reserve the whole range first, so nothing else can be
+            // mapped between the two halves.
+            void* base = mmap(nullptr, 2 * size, PROT_NONE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED)
+            {
+                close(fd);
+                throw_system_error("mmap");
+            }
+
+            auto* bytes = static_cast<std::byte*>(base);
+            for (auto* half : {bytes, bytes + size})
+            {
+                if (mmap(half, size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+                {
+                    munmap(base, 2 * size);
+                    close(fd);
+                    throw_system_error("mmap");
+                }
+            }
+
+            // The mappings keep the memory alive.
+            close(fd);
+            return bytes;
+        }
+    }
+
+    /**
+     * @brief A ring buffer where the values, and the free space after
+     *  them, are always one contiguous block of memory.
+     *
+     * The buffer's memory is mapped twice in a row in the virtual
+     * address space, so the value at position capacity() + i is the
+     * same as the one at i. A sequence of values that wraps around the
+     * end of the buffer can therefore be read or written with a single
+     * pointer, without stitching segments together. This lets e.g. a
+     * protocol decoder parse messages in place.
+     *
+     * The capacity is rounded up so that the buffer fills a whole number
+     * of memory pages. T must be trivially copyable, as the values are
+     * accessed through two different addresses.
+     *
+     * Only available on Linux, as it uses memfd_create.
+     */
+    template <typename T>
+    class MirroredRingBuffer
+    {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "T must be trivially copyable.");
+
+        MirroredRingBuffer() = default;
+
+        /**
+         * @brief Creates a buffer with room for at least
+         *  @a min_capacity values.
+         */
+        explicit MirroredRingBuffer(size_t min_capacity)
+        {
+            if (min_capacity == 0)
+                return;
+
+            const auto page_size = size_t(sysconf(_SC_PAGESIZE));
+            const auto unit = std::lcm(page_size, sizeof(T));
+            const auto size = (min_capacity * sizeof(T) + unit - 1) / unit * unit;
+            values_ = reinterpret_cast<T*>(Detail::map_mirrored_memory(size));
+            capacity_ = size / sizeof(T);
+        }
+
+        MirroredRingBuffer(const MirroredRingBuffer&) = delete;
+
+        MirroredRingBuffer(MirroredRingBuffer&& other) noexcept
+            : values_(std::exchange(other.values_, nullptr)),
+              capacity_(std::exchange(other.capacity_, 0)),
+              start_(std::exchange(other.start_, 0)),
+              size_(std::exchange(other.size_, 0))
+        {}
+
+        ~MirroredRingBuffer()
+        {
+            if (values_)
+                munmap(values_, 2 * capacity_ * sizeof(T));
+        }
+
+        MirroredRingBuffer& operator=(const MirroredRingBuffer&) = delete;
+
+        MirroredRingBuffer& operator=(MirroredRingBuffer&& other) noexcept
+        {
+            std::swap(values_, other.values_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(start_, other.start_);
+            std::swap(size_, other.size_);
+            return *this;
+        }
+
+        /**
+         * @brief Adds @a value to the end of the buffer, replacing the
+         *  oldest value if the buffer is full.
+         *
+         * Does nothing if the buffer's capacity is 0.
+         */
+        void push_back(const T& value)
+        {
+            if (capacity_ == 0)
+                return;
+            if (size_ == capacity_)
+                pop_front();
+            values_[start_ + size_] = value;
+            ++size_;
+        }
+
+        /**
+         * @brief Adds all of @a values to the end of the buffer.
+         *
+         * If the buffer becomes full, the oldest values are overwritten
+         * as with push_back(value).
+         */
+        void push_back(std::span<const T> values)
+        {
+            if (capacity_ == 0)
+                return;
+            if (values.size() > capacity_)
+                values = values.last(capacity_);
+            if (size_ + values.size() > capacity_)
+                pop_front(size_ + values.size() - capacity_);
+            std::copy(values.begin(), values.end(), values_ + start_ + size_);
+            size_ += values.size();
+        }
+
+        /**
+         * @brief Returns the free space after the last value.
+         *
+         * Write values to the beginning of the span and call commit()
+         * to add them to the buffer.
+         */
+        [[nodiscard]]
+        std::span<T> write_span() noexcept
+        {
+            return {values_ + start_ + size_, capacity_ - size_};
+        }
+
+        /**
+         * @brief Adds the first @a n values in write_span() to the
+         *  buffer.
+         */
+        void commit(size_t n)
+        {
+            if (n > capacity_ - size_)
+                CHORASMIA_THROW("Can not commit more values than there is room for.");
+            size_ += n;
+        }
+
+        /**
+         * @brief Returns all the values in the buffer, oldest first, as
+         *  a single span.
+         */
+        [[nodiscard]]
+        std::span<const T> read_span() const noexcept
+        {
+            return {values_ + start_, size_};
+        }
+
+        [[nodiscard]]
+        std::span<T> read_span() noexcept
+        {
+            return {values_ + start_, size_};
+        }
+
+        /**
+         * @brief Removes the @a n oldest values, or all values if there
+         *  are fewer than @a n.
+         */
+        void pop_front(size_t n = 1) noexcept
+        {
+            n = std::min(n, size_);
+            start_ += n;
+            if (start_ >= capacity_)
+                start_ -= capacity_;
+            size_ -= n;
+        }
+
+        void pop_back() noexcept
+        {
+            if (size_ != 0)
+                --size_;
+        }
+
+        void clear() noexcept
+        {
+            start_ = 0;
+            size_ = 0;
+        }
+
+        [[nodiscard]]
+        const T& operator[](size_t i) const noexcept
+        {
+            return values_[start_ + i];
+        }
+
+        [[nodiscard]]
+        T& operator[](size_t i) noexcept
+        {
+            return values_[start_ + i];
+        }
+
+        [[nodiscard]]
+        const T& front() const noexcept
+        {
+            return values_[start_];
+        }
+
+        [[nodiscard]]
+        const T& back() const noexcept
+        {
+            return values_[start_ + size_ - 1];
+        }
+
+        [[nodiscard]]
+        const T* data() const noexcept
+        {
+            return values_ + start_;
+        }
+
+        [[nodiscard]]
+        T* data() noexcept
+        {
+            return values_ + start_;
+        }
+
+        [[nodiscard]]
+        const T* begin() const noexcept
+        {
+            return data();
+        }
+
+        [[nodiscard]]
+        const T* end() const noexcept
+        {
+            return data() + size_;
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]]
+        size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+    private:
+        // The first of the two mappings. values_[capacity_ + i] is the
+        // same memory as values_[i].
+        T* values_ = nullptr;
+        size_t capacity_ = 0;
+        // Always less than capacity_, so that values_ + start_ + size_
+        // stays within the second mapping.
+        size_t start_ = 0;
+        size_t size_ = 0;
+    };
+}
+
+#endif
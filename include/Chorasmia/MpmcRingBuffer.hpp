@@ -0,0 +1,255 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "SpscRingBuffer.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief A fixed-capacity queue for any number of producer and
+     *  consumer threads.
+     *
+     * This is Dmitry Vyukov's bounded MPMC queue: every slot has a
+     * sequence number that tells whether it is ready to be written to
+     * or read from in the current lap around the buffer. A thread
+     * claims a slot with a single compare-and-swap on the enqueue or
+     * dequeue position, and the slot's sequence number hands it over
+     * between producers and consumers, so there are no locks.
+     *
+     * Each slot is padded to a cache line to avoid false sharing
+     * between threads working on neighboring slots.
+     *
+     * try_push and try_pop never block. push and pop claim a position
+     * unconditionally and wait for the slot to become ready, first by
+     * spinning briefly and then with std::atomic::wait, which uses a
+     * futex on Linux. Each slot counts the threads that wait for it, and
+     * the notification, which is a system call, is only made when the
+     * count isn't zero. Queues that only use try_push and try_pop
+     * therefore never make it.
+     *
+     * The slots store their values in uninitialized memory, so T
+     * doesn't have to be default-constructible, and a value is destroyed
+     * as soon as it has been popped.
+     */
+    template <typename T, unsigned N>
+    class MpmcRingBuffer
+    {
+    public:
+        // With a single slot, "full" and "ready for the next push" have
+        // the same sequence number.
+        static_assert(N >= 2, "N must be at least 2.");
+
+        MpmcRingBuffer() noexcept
+        {
+            for (size_t i = 0; i < N; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+
+        ~MpmcRingBuffer()
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                const auto tail = enqueue_pos_.load(std::memory_order_relaxed);
+                for (auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+                     pos < tail; ++pos)
+                {
+                    auto& slot = slots_[pos % N];
+                    if (slot.sequence.load(std::memory_order_relaxed) == pos + 1)
+                        std::destroy_at(slot.value());
+                }
+            }
+        }
+
+        MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+        /**
+         * @brief Adds @a value to the queue unless it is full.
+         *
+         * @a value is only moved from if the function returns true.
+         */
+        template <typename U>
+        bool try_push(U&& value)
+        {
+            auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = slots_[pos % N];
+                const auto seq = slot.sequence.load(std::memory_order_acquire);
+                const auto diff = intptr_t(seq) - intptr_t(pos);
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        std::construct_at(slot.value(), std::forward<U>(value));
+                        publish(slot, pos + 1);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Adds @a value to the queue, waiting for room if it is
+         *  full.
+         */
+        template <typename U>
+        void push(U&& value)
+        {
+            const auto pos = enqueue_pos_.fetch_add(1, std::memory_order_relaxed);
+            auto& slot = slots_[pos % N];
+            wait_for(slot, pos);
+            std::construct_at(slot.value(), std::forward<U>(value));
+            publish(slot, pos + 1);
+        }
+
+        /**
+         * @brief Moves the value at the front of the queue to @a value
+         *  unless the queue is empty.
+         */
+        bool try_pop(T& value)
+        {
+            auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = slots_[pos % N];
+                const auto seq = slot.sequence.load(std::memory_order_acquire);
+                const auto diff = intptr_t(seq) - intptr_t(pos + 1);
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        value = std::move(*slot.value());
+                        std::destroy_at(slot.value());
+                        publish(slot, pos + N);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes and returns the value at the front of the
+         *  queue, waiting for a value if it is empty.
+         */
+        [[nodiscard]]
+        T pop()
+        {
+            const auto pos = dequeue_pos_.fetch_add(1, std::memory_order_relaxed);
+            auto& slot = slots_[pos % N];
+            wait_for(slot, pos + 1);
+            T value = std::move(*slot.value());
+            std::destroy_at(slot.value());
+            publish(slot, pos + N);
+            return value;
+        }
+
+        /**
+         * @brief Returns the approximate number of values in the queue.
+         *
+         * Threads that are waiting in pop are counted as negative
+         * values, and the result is clamped to [0, N].
+         */
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            const auto tail = enqueue_pos_.load(std::memory_order_relaxed);
+            const auto head = dequeue_pos_.load(std::memory_order_relaxed);
+            const auto diff = intptr_t(tail) - intptr_t(head);
+            return size_t(std::clamp<intptr_t>(diff, 0, N));
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        static constexpr size_t capacity() noexcept
+        {
+            return N;
+        }
+
+    private:
+        struct alignas(Detail::CACHE_LINE_SIZE) Slot
+        {
+            std::atomic<size_t> sequence;
+            std::atomic<uint32_t> waiters = 0;
+            alignas(T) std::byte memory[sizeof(T)];
+
+            T* value() noexcept
+            {
+                return reinterpret_cast<T*>(memory);
+            }
+        };
+
+        static constexpr int SPIN_COUNT = 64;
+
+        static void publish(Slot& slot, size_t sequence) noexcept
+        {
+            // Pairs with the increment and load in wait_for: either the
+            // waiting thread sees the new sequence, or this thread sees
+            // the waiter.
+            slot.sequence.store(sequence, std::memory_order_seq_cst);
+            if (slot.waiters.load(std::memory_order_seq_cst) != 0)
+                slot.sequence.notify_all();
+        }
+
+        static void wait_for(Slot& slot, size_t sequence) noexcept
+        {
+            for (int i = 0; i < SPIN_COUNT; ++i)
+            {
+                if (slot.sequence.load(std::memory_order_acquire) == sequence)
+                    return;
+                std::this_thread::yield();
+            }
+
+            slot.waiters.fetch_add(1, std::memory_order_seq_cst);
+            for (;;)
+            {
+                const auto seq = slot.sequence.load(std::memory_order_seq_cst);
+                if (seq == sequence)
+                    break;
+                slot.sequence.wait(seq, std::memory_order_acquire);
+            }
+            slot.waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        alignas(Detail::CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_ = 0;
+        alignas(Detail::CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_ = 0;
+        Slot slots_[N];
+    };
+}
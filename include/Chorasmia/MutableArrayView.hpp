@@ -91,3 +91,11 @@ namespace Chorasmia
         return a.data() == b.data() && a.size() == b.size();
     }
 }
+
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    Chorasmia::MutableArrayView<T>> = true;
+
+template <typename T>
+inline constexpr bool std::ranges::enable_view<
+    Chorasmia::MutableArrayView<T>> = true;
@@ -83,9 +83,9 @@ namespace Chorasmia
         {
             extent = clamp(extent, size_);
             return {
-                data() + extent.origin.row * col_count() + extent.origin.column,
+                data() + extent.origin.row * row_size() + extent.origin.column,
                 extent.size,
-                col_count() - extent.size.columns
+                row_size() - extent.size.columns
             };
         }
 
@@ -113,6 +113,26 @@ namespace Chorasmia
             return size_.rows * size_.columns;
         }
 
+        /**
+         * @brief The number of values between the end of one row and the
+         *  start of the next.
+         */
+        [[nodiscard]]
+        constexpr size_t row_gap() const noexcept
+        {
+            return row_gap_;
+        }
+
+        /**
+         * @brief Returns a random access range of all the values in the
+         *  view, row by row.
+         */
+        [[nodiscard]]
+        constexpr ArrayView2DElements<T, true> elements() const noexcept
+        {
+            return {data_, row_count(), col_count(), row_gap_};
+        }
+
         [[nodiscard]]
         MutableIterator begin() const noexcept
         {
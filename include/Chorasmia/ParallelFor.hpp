@@ -0,0 +1,95 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Chorasmia
+{
+    /**
+     * @brief Selects the multi-threaded overload of an algorithm.
+     */
+    struct ParallelPolicy
+    {
+        /// The maximum number of threads. 0 means
+        /// std::thread::hardware_concurrency().
+        unsigned thread_count = 0;
+    };
+
+    /**
+     * @brief Calls @a func with consecutive sub-ranges of [0, count) on
+     *  up to @a thread_count threads.
+     *
+     * @a func is called as func(first, last) once per sub-range. The
+     * calling thread processes the first sub-range itself. If @a func
+     * throws, the first exception is rethrown when all threads have
+     * finished.
+     *
+     * @param count The number of items.
+     * @param func The function that processes a sub-range.
+     * @param min_chunk_size The smallest number of items that is worth
+     *  processing on a separate thread.
+     * @param thread_count The maximum number of threads. 0 means
+     *  std::thread::hardware_concurrency().
+     */
+    template <typename Func>
+    void parallel_for(size_t count, Func&& func,
+                      size_t min_chunk_size = 1,
+                      unsigned thread_count = 0)
+    {
+        if (count == 0)
+            return;
+
+        if (thread_count == 0)
+            thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        min_chunk_size = std::max<size_t>(min_chunk_size, 1);
+        const auto chunk_count = std::min<size_t>(
+            thread_count, (count + min_chunk_size - 1) / min_chunk_size);
+
+        if (chunk_count <= 1)
+        {
+            func(size_t(0), count);
+            return;
+        }
+
+        std::exception_ptr error;
+        std::mutex mutex;
+        auto run = [&](size_t first, size_t last)
+        {
+            try
+            {
+                func(first, last);
+            }
+            catch (...)
+            {
+                std::scoped_lock lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(chunk_count - 1);
+            for (size_t i = 1; i < chunk_count; ++i)
+            {
+                threads.emplace_back(run,
+                                     i * count / chunk_count,
+                                     (i + 1) * count / chunk_count);
+            }
+            run(0, count / chunk_count);
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,44 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <concepts>
+#include <ostream>
+
+namespace Chorasmia
+{
+    /**
+     * @brief A point in the continuous coordinate system of a 2D array.
+     *
+     * The value at Index2D(i, j) covers the square from (i, j) to
+     * (i + 1, j + 1), i.e. its center is at (i + 0.5, j + 0.5).
+     */
+    template <std::floating_point T>
+    struct Point2D
+    {
+        T row = 0;
+        T column = 0;
+    };
+
+    template <std::floating_point T>
+    constexpr bool operator==(const Point2D<T>& a, const Point2D<T>& b) noexcept
+    {
+        return a.row == b.row && a.column == b.column;
+    }
+
+    template <std::floating_point T>
+    constexpr bool operator!=(const Point2D<T>& a, const Point2D<T>& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    template <std::floating_point T>
+    std::ostream& operator<<(std::ostream& os, const Point2D<T>& point)
+    {
+        return os << '{' << point.row << ", " << point.column << '}';
+    }
+}
@@ -0,0 +1,238 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+#include "MutableArrayView2D.hpp"
+#include "Point2D.hpp"
+
+namespace Chorasmia
+{
+    enum class FillRule
+    {
+        EVEN_ODD,
+        NON_ZERO
+    };
+
+    /**
+     * @brief A polygon made of one or more closed rings.
+     *
+     * The first ring is normally the outer boundary and the remaining
+     * rings are holes. With FillRule::NON_ZERO, holes must have the
+     * opposite orientation of the outer boundary.
+     */
+    using Polygon = std::vector<std::vector<Point2D<double>>>;
+
+    namespace Detail
+    {
+        struct RasterEdge
+        {
+            double row;
+            double column;
+            double slope;
+            size_t first_row;
+            size_t last_row;
+            size_t polygon;
+            int winding;
+        };
+
+        struct RasterCrossing
+        {
+            size_t polygon;
+            double column;
+            int winding;
+        };
+
+        // The first index i where i + 0.5 >= value, clamped to [0, max].
+        inline size_t first_center_at_or_after(double value, size_t max)
+        {
+            const auto i = std::ceil(value - 0.5);
+            if (i <= 0)
+                return 0;
+            if (i >= double(max))
+                return max;
+            return size_t(i);
+        }
+
+        inline void add_raster_edges(std::vector<RasterEdge>& edges,
+                                     const Polygon& polygon,
+                                     size_t polygon_index,
+                                     const Extent2D<size_t>& clip)
+        {
+            const auto row_end = clip.origin.row + clip.size.rows;
+            for (const auto& ring : polygon)
+            {
+                for (size_t i = 0; i < ring.size(); ++i)
+                {
+                    auto p0 = ring[i];
+                    auto p1 = ring[i + 1 == ring.size() ? 0 : i + 1];
+                    if (p0.row == p1.row)
+                        continue;
+
+                    int winding = 1;
+                    if (p0.row > p1.row)
+                    {
+                        std::swap(p0, p1);
+                        winding = -1;
+                    }
+
+                    const auto first = std::max(
+                        first_center_at_or_after(p0.row, row_end),
+                        clip.origin.row);
+                    const auto last = first_center_at_or_after(p1.row, row_end);
+                    if (first >= last)
+                        continue;
+
+                    edges.push_back({p0.row, p0.column,
+                                     (p1.column - p0.column) / (p1.row - p0.row),
+                                     first, last, polygon_index, winding});
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls @a func for every cell in @a dst whose center lies
+     *  inside one of @a polygons.
+     *
+     * @a func is called as func(cell, polygon_index), where cell is a
+     * reference to the value in @a dst. Cells covered by several
+     * polygons are visited once per polygon, in the order the polygons
+     * appear in @a polygons.
+     *
+     * All polygons are rasterized together in a single scanline pass
+     * using an active-edge table, so the cost is proportional to the
+     * number of edges and covered cells rather than to the size of
+     * @a dst. Only cells inside @a clip are visited.
+     */
+    template <typename T, typename Func>
+    void rasterize_polygons(const MutableArrayView2D<T>& dst,
+                            std::span<const Polygon> polygons,
+                            Func func,
+                            FillRule rule = FillRule::EVEN_ODD,
+                            Extent2D<size_t> clip = Extent2D<size_t>(Index2D<size_t>()))
+    {
+        clip = clamp(clip, dst.dimensions());
+        if (is_empty(clip))
+            return;
+
+        std::vector<Detail::RasterEdge> edges;
+        for (size_t i = 0; i < polygons.size(); ++i)
+            Detail::add_raster_edges(edges, polygons[i], i, clip);
+
+        std::sort(edges.begin(), edges.end(),
+                  [](auto& a, auto& b) {return a.first_row < b.first_row;});
+
+        const auto col_begin = clip.origin.column;
+        const auto col_end = clip.origin.column + clip.size.columns;
+        const auto row_end = clip.origin.row + clip.size.rows;
+
+        std::vector<const Detail::RasterEdge*> active;
+        std::vector<Detail::RasterCrossing> crossings;
+        auto next_edge = edges.begin();
+        for (size_t i = clip.origin.row; i < row_end; ++i)
+        {
+            std::erase_if(active, [i](auto* e) {return e->last_row <= i;});
+            for (; next_edge != edges.end() && next_edge->first_row <= i; ++next_edge)
+                active.push_back(&*next_edge);
+
+            if (active.empty())
+            {
+                if (next_edge == edges.end())
+                    break;
+                i = next_edge->first_row - 1;
+                continue;
+            }
+
+            const auto y = double(i) + 0.5;
+            crossings.clear();
+            for (const auto* e : active)
+            {
+                crossings.push_back({e->polygon,
+                                     e->column + (y - e->row) * e->slope,
+                                     e->winding});
+            }
+
+            std::sort(crossings.begin(), crossings.end(),
+                      [](auto& a, auto& b)
+                      {
+                          return a.polygon != b.polygon
+                                 ? a.polygon < b.polygon
+                                 : a.column < b.column;
+                      });
+
+            auto row = dst.row(i);
+            auto fill_span = [&](double from, double to, size_t polygon)
+            {
+                const auto first = std::max(
+                    Detail::first_center_at_or_after(from, col_end), col_begin);
+                const auto last = Detail::first_center_at_or_after(to, col_end);
+                for (size_t j = first; j < last; ++j)
+                    func(row[j], polygon);
+            };
+
+            int winding = 0;
+            for (size_t k = 0; k + 1 < crossings.size(); ++k)
+            {
+                const auto& c = crossings[k];
+                const auto& next = crossings[k + 1];
+                if (c.polygon != next.polygon)
+                {
+                    winding = 0;
+                    continue;
+                }
+
+                if (rule == FillRule::EVEN_ODD)
+                    winding ^= 1;
+                else
+                    winding += c.winding;
+
+                if (winding != 0)
+                    fill_span(c.column, next.column, c.polygon);
+            }
+        }
+    }
+
+    /**
+     * @brief Sets every cell in @a dst whose center lies inside
+     *  @a polygon to @a value.
+     */
+    template <typename T>
+    void fill_polygon(const MutableArrayView2D<T>& dst,
+                      const Polygon& polygon,
+                      const T& value,
+                      FillRule rule = FillRule::EVEN_ODD,
+                      const Extent2D<size_t>& clip = Extent2D<size_t>(Index2D<size_t>()))
+    {
+        rasterize_polygons(dst, std::span(&polygon, 1),
+                           [&](T& cell, size_t) {cell = value;},
+                           rule, clip);
+    }
+
+    /**
+     * @brief Sets every cell in @a dst whose center lies inside
+     *  @a polygons[i] to @a values[i].
+     *
+     * Where polygons overlap, the last of them determines the value.
+     */
+    template <typename T>
+    void fill_polygons(const MutableArrayView2D<T>& dst,
+                       std::span<const Polygon> polygons,
+                       std::span<const std::type_identity_t<T>> values,
+                       FillRule rule = FillRule::EVEN_ODD,
+                       const Extent2D<size_t>& clip = Extent2D<size_t>(Index2D<size_t>()))
+    {
+        if (values.size() < polygons.size())
+            CHORASMIA_THROW("values is smaller than polygons.");
+        rasterize_polygons(dst, polygons,
+                           [&](T& cell, size_t i) {cell = values[i];},
+                           rule, clip);
+    }
+}
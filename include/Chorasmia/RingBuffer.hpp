@@ -6,136 +6,603 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ChorasmiaException.hpp"
 
 namespace Chorasmia
 {
-    template <typename T, unsigned N>
+    /**
+     * @brief A random access iterator over the values in a ring buffer,
+     *  oldest first.
+     *
+     * The second template parameter used to be the buffer's capacity
+     * (RingBufferIterator<T, N>). The iterator no longer depends on the
+     * capacity, and the parameter now tells whether it is a mutable or
+     * a const iterator. Code that named the iterator type explicitly
+     * should use RingBuffer<T, N>::iterator or ::const_iterator instead.
+     */
+    template <typename T, bool IsMutable = false>
     class RingBufferIterator
     {
     public:
-        using difference_type = ptrdiff_t;
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type = T;
-        using pointer = const T*;
-        using reference = const T&;
-        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<IsMutable, T*, const T*>;
+        using reference = std::conditional_t<IsMutable, T&, const T&>;
+
+        RingBufferIterator() = default;
+
+        RingBufferIterator(pointer values, size_t mask, size_t index) noexcept
+            : values_(values), mask_(mask), index_(index)
+        {}
 
-        RingBufferIterator(const T* current, const T* first)
-            : current_(current), first_(first)
+        /**
+         * @brief Makes a const iterator from a mutable one.
+         */
+        template <bool OtherIsMutable>
+            requires (OtherIsMutable && !IsMutable)
+        RingBufferIterator(const RingBufferIterator<T, OtherIsMutable>& it) noexcept
+            : values_(it.values_), mask_(it.mask_), index_(it.index_)
+        {}
+
+        [[nodiscard]]
+        reference operator*() const noexcept
         {
+            return values_[index_ & mask_];
         }
 
         [[nodiscard]]
-        const T& operator*() const
+        pointer operator->() const noexcept
         {
-            return *current_;
+            return &values_[index_ & mask_];
         }
 
-        const T* operator->() const
+        [[nodiscard]]
+        reference operator[](difference_type n) const noexcept
         {
-            return current_;
+            return values_[(index_ + n) & mask_];
         }
 
-        RingBufferIterator& operator++()
+        RingBufferIterator& operator++() noexcept
         {
-            if (std::distance(first_, ++current_) == N + 1)
-                current_ = first_;
+            ++index_;
             return *this;
         }
 
-        RingBufferIterator operator++(int)
+        RingBufferIterator operator++(int) noexcept
         {
             auto result = *this;
-            if (std::distance(first_, ++current_) == N + 1)
-                current_ = first_;
+            ++index_;
             return result;
         }
 
-        RingBufferIterator& operator--()
+        RingBufferIterator& operator--() noexcept
         {
-            if (first_ != current_)
-                --current_;
-            else
-                current_ = first_ + N;
+            --index_;
             return *this;
         }
 
-        RingBufferIterator operator--(int)
+        RingBufferIterator operator--(int) noexcept
         {
             auto result = *this;
-            if (first_ != current_)
-                --current_;
-            else
-                current_ = first_ + N;
+            --index_;
             return result;
         }
 
+        RingBufferIterator& operator+=(difference_type n) noexcept
+        {
+            index_ += n;
+            return *this;
+        }
+
+        RingBufferIterator& operator-=(difference_type n) noexcept
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        [[nodiscard]]
+        friend RingBufferIterator
+        operator+(RingBufferIterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        [[nodiscard]]
+        friend RingBufferIterator
+        operator+(difference_type n, RingBufferIterator it) noexcept
+        {
+            return it += n;
+        }
+
         [[nodiscard]]
-        friend bool operator==(const RingBufferIterator& a, const RingBufferIterator& b)
+        friend RingBufferIterator
+        operator-(RingBufferIterator it, difference_type n) noexcept
         {
-            return a.current_ == b.current_ && a.first_ == b.first_;
+            return it -= n;
         }
 
+        // The logical positions may wrap around zero after push_front,
+        // so the difference is computed with unsigned arithmetic.
         [[nodiscard]]
-        friend bool operator!=(const RingBufferIterator& a, const RingBufferIterator& b)
+        friend difference_type
+        operator-(const RingBufferIterator& a, const RingBufferIterator& b) noexcept
         {
-            return a.current_ != b.current_ || a.first_ != b.first_;
+            return difference_type(a.index_ - b.index_);
         }
 
         [[nodiscard]]
-        friend RingBufferIterator operator+(RingBufferIterator it, size_t n)
+        friend bool
+        operator==(const RingBufferIterator& a, const RingBufferIterator& b) noexcept
         {
-            auto distance = std::distance(it.first_, it.current_);
-            auto offset = n < (N  + 1 - distance) ? distance + n
-                                                  : n - (N + 1 - distance);
-            return RingBufferIterator(it.first_ + offset, it.first_);
+            return a.index_ == b.index_ && a.values_ == b.values_;
         }
 
         [[nodiscard]]
-        friend RingBufferIterator operator-(RingBufferIterator it, size_t n)
+        friend std::strong_ordering
+        operator<=>(const RingBufferIterator& a, const RingBufferIterator& b) noexcept
         {
-            auto distance = std::distance(it.first_, it.current_);
-            auto offset = n <= distance ? distance - n
-                                        : N + 1 - (n - distance);
-            return RingBufferIterator(it.first_ + offset, it.first_);
+            return a - b <=> 0;
         }
+
     private:
-        const T* current_ = nullptr;
-        const T* first_ = nullptr;
+        template <typename, bool>
+        friend class RingBufferIterator;
+
+        pointer values_ = nullptr;
+        size_t mask_ = 0;
+        // The logical position in the buffer. It is only reduced to an
+        // index in values_ (with mask_) when the iterator is dereferenced.
+        size_t index_ = 0;
     };
 
-    template <typename T, unsigned N>
-    class RingBuffer
+    namespace Detail
+    {
+        // Uninitialized, suitably aligned memory for the values in a
+        // ring buffer. BasicRingBuffer constructs and destroys the
+        // values, so copying the storage doesn't copy them.
+        template <typename T, unsigned N>
+        class FixedRingBufferStorage
+        {
+        public:
+            static_assert(N > 0, "N must be greater than 0.");
+
+            // The values live inside the object and must be moved one
+            // by one.
+            static constexpr bool IS_INLINE = true;
+
+            FixedRingBufferStorage() noexcept = default;
+
+            FixedRingBufferStorage(const FixedRingBufferStorage&) noexcept
+            {}
+
+            FixedRingBufferStorage& operator=(const FixedRingBufferStorage&) noexcept
+            {
+                return *this;
+            }
+
+            [[nodiscard]]
+            static constexpr size_t capacity() noexcept
+            {
+                return N;
+            }
+
+            [[nodiscard]]
+            static constexpr size_t mask() noexcept
+            {
+                return std::bit_ceil(N) - 1;
+            }
+
+            [[nodiscard]]
+            T* data() noexcept
+            {
+                return reinterpret_cast<T*>(memory_);
+            }
+
+            [[nodiscard]]
+            const T* data() const noexcept
+            {
+                return reinterpret_cast<const T*>(memory_);
+            }
+
+        private:
+            alignas(T) std::byte memory_[sizeof(T) * std::bit_ceil(N)];
+        };
+
+        template <typename T>
+        class DynamicRingBufferStorage
+        {
+        public:
+            static constexpr bool IS_INLINE = false;
+
+            DynamicRingBufferStorage() = default;
+
+            DynamicRingBufferStorage(size_t capacity)
+                : capacity_(capacity),
+                  mask_(capacity == 0 ? 0 : std::bit_ceil(capacity) - 1)
+            {
+                if (capacity != 0)
+                    values_ = std::allocator<T>().allocate(mask_ + 1);
+            }
+
+            DynamicRingBufferStorage(const DynamicRingBufferStorage& other)
+                : DynamicRingBufferStorage(other.capacity_)
+            {}
+
+            DynamicRingBufferStorage(DynamicRingBufferStorage&& other) noexcept
+                : values_(std::exchange(other.values_, nullptr)),
+                  capacity_(std::exchange(other.capacity_, 0)),
+                  mask_(std::exchange(other.mask_, 0))
+            {}
+
+            ~DynamicRingBufferStorage()
+            {
+                if (values_)
+                    std::allocator<T>().deallocate(values_, mask_ + 1);
+            }
+
+            DynamicRingBufferStorage& operator=(const DynamicRingBufferStorage& other)
+            {
+                if (this != &other && capacity_ != other.capacity_)
+                    *this = DynamicRingBufferStorage(other);
+                return *this;
+            }
+
+            DynamicRingBufferStorage& operator=(DynamicRingBufferStorage&& other) noexcept
+            {
+                std::swap(values_, other.values_);
+                std::swap(capacity_, other.capacity_);
+                std::swap(mask_, other.mask_);
+                return *this;
+            }
+
+            [[nodiscard]]
+            size_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+            [[nodiscard]]
+            size_t mask() const noexcept
+            {
+                return mask_;
+            }
+
+            [[nodiscard]]
+            T* data() noexcept
+            {
+                return values_;
+            }
+
+            [[nodiscard]]
+            const T* data() const noexcept
+            {
+                return values_;
+            }
+
+        private:
+            T* values_ = nullptr;
+            size_t capacity_ = 0;
+            size_t mask_ = 0;
+        };
+    }
+
+    /**
+     * @brief A circular buffer that holds the last capacity() values
+     *  that were added to it.
+     *
+     * @a Storage provides the values. It rounds the number of values
+     * it allocates up to a power of two so that positions in the buffer
+     * can be computed with a bit mask instead of a division. The buffer
+     * keeps its start position and size separately, so it doesn't need
+     * a spare slot to tell a full buffer from an empty one.
+     *
+     * The values are constructed when they are added and destroyed
+     * when they are removed or overwritten, so T doesn't need to be
+     * default-constructible and can be move-only.
+     *
+     * Use RingBuffer for a capacity that is known at compile time and
+     * DynamicRingBuffer otherwise.
+     */
+    template <typename T, typename Storage>
+    class BasicRingBuffer
     {
     public:
-        using iterator = RingBufferIterator<T, N>;
+        using iterator = RingBufferIterator<T, true>;
+        using const_iterator = RingBufferIterator<T>;
+
+        BasicRingBuffer() = default;
+
+        explicit BasicRingBuffer(Storage storage)
+            : storage_(std::move(storage))
+        {}
+
+        BasicRingBuffer(const BasicRingBuffer& other)
+            : storage_(other.storage_)
+        {
+            try
+            {
+                for (const auto& value : other)
+                    emplace_back(value);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        BasicRingBuffer(BasicRingBuffer&& other)
+            noexcept(!Storage::IS_INLINE || std::is_nothrow_move_constructible_v<T>)
+        {
+            take_values(other);
+        }
+
+        ~BasicRingBuffer()
+        {
+            clear();
+        }
+
+        BasicRingBuffer& operator=(const BasicRingBuffer& other)
+        {
+            if (this != &other)
+                *this = BasicRingBuffer(other);
+            return *this;
+        }
+
+        BasicRingBuffer& operator=(BasicRingBuffer&& other)
+            noexcept(!Storage::IS_INLINE || std::is_nothrow_move_constructible_v<T>)
+        {
+            if (this != &other)
+            {
+                clear();
+                take_values(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Adds @a value to the end of the buffer, replacing the
+         *  oldest value if the buffer is full.
+         *
+         * Does nothing if the buffer's capacity is 0.
+         */
+        void push_back(const T& value)
+        {
+            if (capacity() != 0)
+                emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            if (capacity() != 0)
+                emplace_back(std::move(value));
+        }
 
-        void push_back(T value)
+        /**
+         * @brief Constructs a value at the end of the buffer, replacing
+         *  the oldest value if the buffer is full.
+         *
+         * Unlike push_back, this throws if the buffer's capacity is 0.
+         */
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
         {
-            auto index = (start_index_ + size_) % (N + 1);
-            values_[index] = std::move(value);
-            if (size_ == N)
-                start_index_ = (start_index_ + 1) % (N + 1);
+            if (capacity() == 0)
+                CHORASMIA_THROW("The ring buffer has no capacity.");
+
+            if (size_ != capacity())
+            {
+                auto* value = std::construct_at(slot(start_ + size_),
+                                                std::forward<Args>(args)...);
+                ++size_;
+                return *value;
+            }
+
+            // The buffer is full. The new value is constructed before the
+            // oldest value is removed, since args may refer to it, and so
+            // that the buffer is unchanged if the constructor throws.
+            T* value;
+            if (has_spare_slot())
+            {
+                value = std::construct_at(slot(start_ + size_),
+                                          std::forward<Args>(args)...);
+                pop_front();
+            }
+            else
+            {
+                T tmp(std::forward<Args>(args)...);
+                pop_front();
+                value = std::construct_at(slot(start_ + size_), std::move(tmp));
+            }
+            ++size_;
+            return *value;
+        }
+
+        /**
+         * @brief Adds @a value to the front of the buffer, replacing the
+         *  newest value if the buffer is full.
+         *
+         * Does nothing if the buffer's capacity is 0.
+         */
+        void push_front(const T& value)
+        {
+            if (capacity() != 0)
+                emplace_front(value);
+        }
+
+        void push_front(T&& value)
+        {
+            if (capacity() != 0)
+                emplace_front(std::move(value));
+        }
+
+        /**
+         * @brief Constructs a value at the front of the buffer, replacing
+         *  the newest value if the buffer is full.
+         *
+         * Throws if the buffer's capacity is 0.
+         */
+        template <typename... Args>
+        T& emplace_front(Args&&... args)
+        {
+            if (capacity() == 0)
+                CHORASMIA_THROW("The ring buffer has no capacity.");
+
+            // As in emplace_back, the newest value is removed after the
+            // new value has been constructed.
+            T* value;
+            if (size_ != capacity() || has_spare_slot())
+            {
+                value = std::construct_at(slot(start_ - 1),
+                                          std::forward<Args>(args)...);
+                if (size_ == capacity())
+                    pop_back();
+            }
             else
-                size_++;
+            {
+                T tmp(std::forward<Args>(args)...);
+                pop_back();
+                value = std::construct_at(slot(start_ - 1), std::move(tmp));
+            }
+            --start_;
+            ++size_;
+            return *value;
+        }
+
+        /**
+         * @brief Adds all of @a values to the end of the buffer.
+         *
+         * If the buffer becomes full, the oldest values are overwritten
+         * as with push_back(value). The values are copied in at most two
+         * contiguous blocks.
+         *
+         * @a values can refer to values in the buffer itself, e.g. one
+         * of the spans returned by as_spans().
+         */
+        void push_back(std::span<const T> values)
+        {
+            const auto cap = capacity();
+            if (cap == 0)
+                return;
+            if (values.size() > cap)
+                values = values.last(cap);
+
+            if (size_ + values.size() > cap)
+            {
+                // Values that are about to be removed can't be copied
+                // from the buffer afterwards.
+                if (is_in_storage(values))
+                {
+                    const std::vector<T> copy(values.begin(), values.end());
+                    push_back(std::span<const T>(copy));
+                    return;
+                }
+                pop_front(size_ + values.size() - cap);
+            }
+
+            const auto end = start_ + size_;
+            const auto [first, second] = get_segments(end, values.size());
+            std::uninitialized_copy_n(values.begin(), first, slot(end));
+            try
+            {
+                std::uninitialized_copy_n(values.begin() + first, second,
+                                          storage_.data());
+            }
+            catch (...)
+            {
+                std::destroy_n(slot(end), first);
+                throw;
+            }
+            size_ += values.size();
         }
 
         void pop_back()
         {
-            if (size_ != 0)
-                size_--;
+            if (size_ == 0)
+                return;
+            --size_;
+            std::destroy_at(slot(start_ + size_));
+        }
+
+        /**
+         * @brief Removes the @a n oldest values, or all values if there
+         *  are fewer than @a n.
+         */
+        void pop_front(size_t n = 1)
+        {
+            n = std::min(n, size_);
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    std::destroy_at(slot(start_ + i));
+            }
+            start_ += n;
+            size_ -= n;
+        }
+
+        /**
+         * @brief Copies values from the front of the buffer to @a values
+         *  without removing them.
+         *
+         * @return The number of values copied, which is the smaller of
+         *  size() and values.size().
+         */
+        size_t copy_out(std::span<T> values) const
+        {
+            const auto n = std::min(values.size(), size_);
+            const auto [first, second] = as_spans();
+            const auto n1 = std::min(n, first.size());
+            std::copy_n(first.begin(), n1, values.begin());
+            std::copy_n(second.begin(), n - n1, values.begin() + n1);
+            return n;
+        }
+
+        /**
+         * @brief Returns the values in the buffer as (at most) two
+         *  contiguous blocks, oldest first.
+         *
+         * The second span is empty unless the values wrap around the
+         * end of the storage.
+         */
+        [[nodiscard]]
+        std::pair<std::span<const T>, std::span<const T>> as_spans() const
+        {
+            const auto [first, second] = get_segments(start_, size_);
+            const auto* data = storage_.data();
+            return {{data + (start_ & mask()), first}, {data, second}};
+        }
+
+        [[nodiscard]]
+        std::pair<std::span<T>, std::span<T>> as_spans()
+        {
+            const auto [first, second] = get_segments(start_, size_);
+            auto* data = storage_.data();
+            return {{data + (start_ & mask()), first}, {data, second}};
         }
 
         [[nodiscard]]
         const T& operator[](size_t i) const
         {
-            return values_[(start_index_ + i) % (N + 1)];
+            return storage_.data()[(start_ + i) & mask()];
         }
 
         [[nodiscard]]
         T& operator[](size_t i)
         {
-            return values_[(start_index_ + i) % (N + 1)];
+            return storage_.data()[(start_ + i) & mask()];
         }
 
         [[nodiscard]]
@@ -144,6 +611,12 @@ namespace Chorasmia
             return size_;
         }
 
+        [[nodiscard]]
+        size_t capacity() const
+        {
+            return storage_.capacity();
+        }
+
         [[nodiscard]]
         bool empty() const
         {
@@ -153,51 +626,155 @@ namespace Chorasmia
         [[nodiscard]]
         const T& front() const
         {
-            return values_[start_index_];
+            return (*this)[0];
         }
 
         [[nodiscard]]
         T& front()
         {
-            return values_[start_index_];
+            return (*this)[0];
         }
 
         [[nodiscard]]
         const T& back() const
         {
-            return values_[(start_index_ + size_ - 1) % (N + 1)];
+            return (*this)[size_ - 1];
         }
 
         [[nodiscard]]
         T& back()
         {
-            return values_[(start_index_ + size_ - 1) % (N + 1)];
+            return (*this)[size_ - 1];
         }
 
         void clear()
         {
-            start_index_ = 0;
-            size_ = 0;
+            pop_front(size_);
+            start_ = 0;
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const
+        {
+            return const_iterator(storage_.data(), mask(), start_);
         }
 
         [[nodiscard]]
-        iterator begin() const
+        iterator begin()
         {
-            return iterator(&values_[start_index_], &values_[0]);
+            return iterator(storage_.data(), mask(), start_);
         }
 
         [[nodiscard]]
-        iterator end() const
+        const_iterator end() const
         {
-            auto index = (start_index_ + size_) % (N + 1);
-            return iterator(&values_[index], &values_[0]);
+            return const_iterator(storage_.data(), mask(), start_ + size_);
+        }
+
+        [[nodiscard]]
+        iterator end()
+        {
+            return iterator(storage_.data(), mask(), start_ + size_);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const
+        {
+            return end();
         }
 
     private:
-        // Include one extra value in values_ to leave a gap between end()
-        // and begin(). Without this gap, begin() == end() when size_ == N.
-        T values_[N + 1];
-        size_t start_index_ = 0;
+        [[nodiscard]]
+        size_t mask() const
+        {
+            return storage_.mask();
+        }
+
+        [[nodiscard]]
+        T* slot(size_t pos) noexcept
+        {
+            return storage_.data() + (pos & mask());
+        }
+
+        // Returns true if values overlaps the buffer's storage.
+        [[nodiscard]]
+        bool is_in_storage(std::span<const T> values) const
+        {
+            const std::less<const T*> less;
+            const auto* data = storage_.data();
+            return less(values.data(), data + mask() + 1)
+                   && less(data, values.data() + values.size());
+        }
+
+        // Returns true if the storage has a slot that is unused even when
+        // the buffer is full, i.e. if the capacity isn't a power of two.
+        [[nodiscard]]
+        bool has_spare_slot() const
+        {
+            return capacity() <= mask();
+        }
+
+        // Moves the values from other to this buffer, which must be
+        // empty, and leaves other empty.
+        void take_values(BasicRingBuffer& other)
+        {
+            if constexpr (Storage::IS_INLINE)
+            {
+                for (size_t i = 0; i < other.size_; ++i)
+                    emplace_back(std::move(other[i]));
+                other.clear();
+            }
+            else
+            {
+                storage_ = std::move(other.storage_);
+                start_ = std::exchange(other.start_, 0);
+                size_ = std::exchange(other.size_, 0);
+            }
+        }
+
+        // Splits the n values starting at logical position pos into the
+        // part before the end of the storage and the part after it.
+        [[nodiscard]]
+        std::pair<size_t, size_t> get_segments(size_t pos, size_t n) const
+        {
+            const auto first = std::min(n, mask() + 1 - (pos & mask()));
+            return {first, n - first};
+        }
+
+        Storage storage_;
+        // The logical position of the first value. It is reduced to an
+        // index in the storage with mask(), and since the storage size is
+        // a power of two, that works even when push_front makes it wrap
+        // around zero.
+        size_t start_ = 0;
         size_t size_ = 0;
     };
+
+    /**
+     * @brief A ring buffer with room for @a N values stored inside the
+     *  object itself.
+     *
+     * The capacity is exactly @a N, but the inline storage is rounded
+     * up to std::bit_ceil(N) values so that positions can be computed
+     * with a mask. For example, RingBuffer<T, 1025> has storage for
+     * 2048 values. Prefer powers of two for N when the size of the
+     * object matters.
+     */
+    template <typename T, unsigned N>
+    using RingBuffer = BasicRingBuffer<T, Detail::FixedRingBufferStorage<T, N>>;
+
+    /**
+     * @brief A ring buffer whose capacity is set when it is constructed,
+     *  with the values stored on the heap.
+     *
+     * Example: `DynamicRingBuffer<double> window(config.window_size);`
+     */
+    template <typename T>
+    using DynamicRingBuffer = BasicRingBuffer<T, Detail::DynamicRingBufferStorage<T>>;
 }
@@ -0,0 +1,446 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "IntervalMap.hpp"
+
+namespace Chorasmia
+{
+    template <typename Key, typename Value, size_t LeafSize>
+    class SegmentedIntervalMap;
+
+    /**
+     * @brief A bidirectional iterator over the boundaries in a
+     *  SegmentedIntervalMap.
+     */
+    template <typename Key, typename Value, size_t LeafSize>
+    class SegmentedIntervalMapIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<Key, Value>;
+        using difference_type = ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        SegmentedIntervalMapIterator() = default;
+
+        [[nodiscard]]
+        reference operator*() const
+        {
+            return (*(*leaves_)[leaf_])[offset_];
+        }
+
+        [[nodiscard]]
+        pointer operator->() const
+        {
+            return &(*(*leaves_)[leaf_])[offset_];
+        }
+
+        SegmentedIntervalMapIterator& operator++()
+        {
+            if (++offset_ == (*leaves_)[leaf_]->size()
+                && leaf_ + 1 != leaves_->size())
+            {
+                ++leaf_;
+                offset_ = 0;
+            }
+            return *this;
+        }
+
+        SegmentedIntervalMapIterator operator++(int)
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        SegmentedIntervalMapIterator& operator--()
+        {
+            if (offset_ == 0)
+            {
+                --leaf_;
+                offset_ = (*leaves_)[leaf_]->size();
+            }
+            --offset_;
+            return *this;
+        }
+
+        SegmentedIntervalMapIterator operator--(int)
+        {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const SegmentedIntervalMapIterator& a,
+                               const SegmentedIntervalMapIterator& b)
+        {
+            return a.leaf_ == b.leaf_ && a.offset_ == b.offset_;
+        }
+
+        [[nodiscard]]
+        friend bool operator!=(const SegmentedIntervalMapIterator& a,
+                               const SegmentedIntervalMapIterator& b)
+        {
+            return !(a == b);
+        }
+
+    private:
+        friend class SegmentedIntervalMap<Key, Value, LeafSize>;
+
+        using Leaf = std::vector<std::pair<Key, Value>>;
+        using LeafPtr = std::shared_ptr<Leaf>;
+
+        SegmentedIntervalMapIterator(const std::vector<LeafPtr>* leaves,
+                                     size_t leaf, size_t offset)
+            : leaves_(leaves), leaf_(leaf), offset_(offset)
+        {}
+
+        const std::vector<LeafPtr>* leaves_ = nullptr;
+        size_t leaf_ = 0;
+        // The end iterator is one past the last value in the last leaf.
+        size_t offset_ = 0;
+    };
+
+    /**
+     * @brief An IntervalMap that stores its boundaries in a sequence of
+     *  sorted leaves with at most @a LeafSize boundaries each.
+     *
+     * It has the same semantics as IntervalMap, including the margin
+     * for floating point keys, and produces the same boundaries for the
+     * same sequence of inserts. Insert and erase only move the values
+     * in one or two leaves, rather than everything after the insertion
+     * point, so building a map with millions of boundaries one insert
+     * at a time is fast.
+     *
+     * find does a binary search over the first key of every leaf, which
+     * are stored in a separate contiguous array, and then a binary
+     * search within a single leaf.
+     *
+     * The boundaries aren't contiguous, so there is no data() function.
+     *
+     * Copies of the map share their leaves until they are modified,
+     * so a copy only costs a pointer and a key per leaf. A leaf is
+     * copied the first time it is modified while another map still
+     * refers to it, which makes the map suitable for snapshots (see
+     * ConcurrentIntervalMap).
+     */
+    template <typename Key, typename Value, size_t LeafSize = 256>
+    class SegmentedIntervalMap
+    {
+    public:
+        static_assert(LeafSize >= 4, "LeafSize must be at least 4.");
+
+        using Iterator = SegmentedIntervalMapIterator<Key, Value, LeafSize>;
+
+        explicit SegmentedIntervalMap(Value defaultValue = {},
+                                      Key margin = get_default_margin<Key>())
+            : leaves_{std::make_shared<Leaf>(
+                  Leaf{{std::numeric_limits<Key>::lowest(), std::move(defaultValue)},
+                       {std::numeric_limits<Key>::max(), Value()}})},
+              leaf_keys_{std::numeric_limits<Key>::lowest()},
+              size_(2),
+              margin_(margin)
+        {}
+
+        [[nodiscard]]
+        Key margin() const
+        {
+            return margin_;
+        }
+
+        [[nodiscard]]
+        size_t size() const
+        {
+            return size_;
+        }
+
+        [[nodiscard]]
+        Iterator find(Key key) const
+        {
+            const auto [leaf, offset] = find_impl(key);
+            return Iterator(&leaves_, leaf, offset);
+        }
+
+        void insert(Key key, Value value)
+        {
+            const auto pos = find_impl(key);
+            if (are_equal(at(pos).first, key))
+            {
+                mutable_at(pos).second = std::move(value);
+                return;
+            }
+
+            insert_at({pos.leaf, pos.offset + 1}, {key, std::move(value)});
+        }
+
+        void insert(Key from, Key to, Value value)
+        {
+            if (from > to)
+                std::swap(from, to);
+            else if (from == to)
+                return;
+
+            const auto from_pos = find_impl(from);
+            const auto to_pos = find_impl(to);
+            const bool from_exists = are_equal(at(from_pos).first, from);
+
+            // Both ends are inside the same interval: split it in three.
+            if (from_pos == to_pos && !from_exists)
+            {
+                auto old_value = at(from_pos).second;
+                const auto pos = insert_at({from_pos.leaf, from_pos.offset + 1},
+                                           {to, std::move(old_value)});
+                insert_at(pos, {from, std::move(value)});
+                return;
+            }
+
+            // Remove the boundaries between from and to, move the
+            // boundary at to_pos to to, and add from before it.
+            const Position start = from_exists
+                                   ? from_pos
+                                   : Position{from_pos.leaf, from_pos.offset + 1};
+            const auto pos = erase_range(start, to_pos);
+            set_key(pos, to);
+            insert_at(pos, {from, std::move(value)});
+        }
+
+        [[nodiscard]]
+        Iterator begin() const
+        {
+            return Iterator(&leaves_, 0, 0);
+        }
+
+        [[nodiscard]]
+        Iterator end() const
+        {
+            return Iterator(&leaves_, leaves_.size() - 1, leaves_.back()->size());
+        }
+
+        /**
+         * @brief Returns the number of leaves the boundaries are
+         *  stored in.
+         */
+        [[nodiscard]]
+        size_t leaf_count() const
+        {
+            return leaves_.size();
+        }
+
+    private:
+        using Leaf = std::vector<std::pair<Key, Value>>;
+        using LeafPtr = std::shared_ptr<Leaf>;
+
+        struct Position
+        {
+            size_t leaf;
+            size_t offset;
+
+            bool operator==(const Position&) const = default;
+        };
+
+        [[nodiscard]]
+        constexpr bool are_equal(Key a, Key b) const
+        {
+            return Detail::are_interval_keys_equal(a, b, margin_);
+        }
+
+        [[nodiscard]]
+        constexpr bool is_less(Key a, Key b) const
+        {
+            return Detail::is_interval_key_less(a, b, margin_);
+        }
+
+        [[nodiscard]]
+        const std::pair<Key, Value>& at(Position pos) const
+        {
+            return (*leaves_[pos.leaf])[pos.offset];
+        }
+
+        [[nodiscard]]
+        std::pair<Key, Value>& mutable_at(Position pos)
+        {
+            return mutable_leaf(pos.leaf)[pos.offset];
+        }
+
+        // Returns the leaf at index, after replacing it with a copy if
+        // other maps refer to it as well.
+        [[nodiscard]]
+        Leaf& mutable_leaf(size_t index)
+        {
+            auto& leaf = leaves_[index];
+            if (leaf.use_count() == 1)
+            {
+                // The other maps that referred to the leaf may have been
+                // destroyed in other threads. Make sure their reads
+                // happen before our writes.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return *leaf;
+            }
+
+            auto copy = std::make_shared<Leaf>();
+            copy->reserve(LeafSize + 1);
+            copy->assign(leaf->begin(), leaf->end());
+            leaf = std::move(copy);
+            return *leaf;
+        }
+
+        // The same search as IntervalMap::find_impl, first among the
+        // leaves and then within one.
+        [[nodiscard]]
+        Position find_impl(Key value) const
+        {
+            size_t first = 0, last = leaf_keys_.size();
+            while (last - first > 1)
+            {
+                auto m = first + (last - first) / 2;
+                if (is_less(value, leaf_keys_[m]))
+                    last = m;
+                else
+                    first = m;
+            }
+
+            const auto& leaf = *leaves_[first];
+            size_t lo = 0, hi = leaf.size();
+            while (hi - lo > 1)
+            {
+                auto m = lo + (hi - lo) / 2;
+                if (is_less(value, leaf[m].first))
+                    hi = m;
+                else
+                    lo = m;
+            }
+            return {first, lo};
+        }
+
+        void set_key(Position pos, Key key)
+        {
+            mutable_at(pos).first = key;
+            if (pos.offset == 0)
+                leaf_keys_[pos.leaf] = key;
+        }
+
+        // Inserts entry before pos, and returns the position of the
+        // new entry. pos.offset can be equal to the size of the leaf.
+        Position insert_at(Position pos, std::pair<Key, Value> entry)
+        {
+            auto& leaf = mutable_leaf(pos.leaf);
+            leaf.insert(leaf.begin() + ptrdiff_t(pos.offset), std::move(entry));
+            if (pos.offset == 0)
+                leaf_keys_[pos.leaf] = leaf.front().first;
+            ++size_;
+
+            if (leaf.size() <= LeafSize)
+                return pos;
+
+            const auto half = leaf.size() / 2;
+            split_leaf(pos.leaf, half);
+            if (pos.offset < half)
+                return pos;
+            return {pos.leaf + 1, pos.offset - half};
+        }
+
+        void split_leaf(size_t index, size_t offset)
+        {
+            auto& leaf = mutable_leaf(index);
+            const auto mid = leaf.begin() + ptrdiff_t(offset);
+            auto new_leaf = std::make_shared<Leaf>();
+            new_leaf->reserve(LeafSize + 1);
+            new_leaf->insert(new_leaf->end(), std::make_move_iterator(mid),
+                             std::make_move_iterator(leaf.end()));
+            leaf.erase(mid, leaf.end());
+
+            const auto key = new_leaf->front().first;
+            leaves_.insert(leaves_.begin() + ptrdiff_t(index + 1), std::move(new_leaf));
+            leaf_keys_.insert(leaf_keys_.begin() + ptrdiff_t(index + 1), key);
+        }
+
+        // Removes the boundaries from first up to, but not including,
+        // last, and returns the position of the boundary that was at
+        // last.
+        Position erase_range(Position first, Position last)
+        {
+            if (first.offset == leaves_[first.leaf]->size())
+                first = {first.leaf + 1, 0};
+            if (first == last)
+                return last;
+
+            if (first.leaf == last.leaf)
+            {
+                auto& leaf = mutable_leaf(first.leaf);
+                leaf.erase(leaf.begin() + ptrdiff_t(first.offset),
+                           leaf.begin() + ptrdiff_t(last.offset));
+                size_ -= last.offset - first.offset;
+                if (first.offset == 0)
+                    leaf_keys_[first.leaf] = leaf.front().first;
+                return merge_small_leaf(first);
+            }
+
+            // Trim the first and last leaves, and remove the ones in
+            // between.
+            auto& head = mutable_leaf(first.leaf);
+            size_ -= head.size() - first.offset;
+            head.erase(head.begin() + ptrdiff_t(first.offset), head.end());
+
+            auto& tail = mutable_leaf(last.leaf);
+            size_ -= last.offset;
+            tail.erase(tail.begin(), tail.begin() + ptrdiff_t(last.offset));
+            leaf_keys_[last.leaf] = tail.front().first;
+
+            auto erase_from = first.leaf + (head.empty() ? 0 : 1);
+            for (auto i = first.leaf + 1; i < last.leaf; ++i)
+                size_ -= leaves_[i]->size();
+            leaves_.erase(leaves_.begin() + ptrdiff_t(erase_from),
+                          leaves_.begin() + ptrdiff_t(last.leaf));
+            leaf_keys_.erase(leaf_keys_.begin() + ptrdiff_t(erase_from),
+                             leaf_keys_.begin() + ptrdiff_t(last.leaf));
+            return merge_small_leaf({erase_from, 0});
+        }
+
+        // Merges the leaf at pos with its predecessor if they fit in one
+        // leaf together and one of them is small, and returns the new
+        // position of the boundary at pos.
+        Position merge_small_leaf(Position pos)
+        {
+            if (pos.leaf == 0)
+                return pos;
+
+            const auto prev_size = leaves_[pos.leaf - 1]->size();
+            const auto leaf_size = leaves_[pos.leaf]->size();
+            if (prev_size + leaf_size > LeafSize
+                || std::min(prev_size, leaf_size) > LeafSize / 4)
+            {
+                return pos;
+            }
+
+            const Position result = {pos.leaf - 1, prev_size + pos.offset};
+            auto& prev = mutable_leaf(pos.leaf - 1);
+            const auto& leaf = *leaves_[pos.leaf];
+            // The leaf is removed, but other maps may still refer to it.
+            prev.insert(prev.end(), leaf.begin(), leaf.end());
+            leaves_.erase(leaves_.begin() + ptrdiff_t(pos.leaf));
+            leaf_keys_.erase(leaf_keys_.begin() + ptrdiff_t(pos.leaf));
+            return result;
+        }
+
+        std::vector<LeafPtr> leaves_;
+        // The key of the first boundary in each leaf.
+        std::vector<Key> leaf_keys_;
+        size_t size_;
+        Key margin_;
+    };
+}
@@ -0,0 +1,359 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "Array2D.hpp"
+#include "ArrayView2DAlgorithms.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief A 2D array with copy-on-write semantics, where copies share
+     *  their values until one of them is modified.
+     *
+     * The values are stored in rectangular tiles of reference-counted
+     * memory. Copying a SharedArray2D is O(1). The first modification
+     * after a copy duplicates the table of tile pointers, and every
+     * modified tile is duplicated the first time it is written to, so
+     * an edit only costs the tiles it touches.
+     *
+     * Different SharedArray2D objects can be used from different threads
+     * without synchronization even when they share tiles, but a single
+     * object must not be copied on one thread while it is modified on
+     * another.
+     */
+    template <typename T>
+    class SharedArray2D
+    {
+    public:
+        static constexpr Size2D<size_t> DEFAULT_TILE_SIZE = {64, 64};
+
+        SharedArray2D() = default;
+
+        explicit SharedArray2D(Size2D<size_t> size,
+                               const T& value = T(),
+                               Size2D<size_t> tile_size = DEFAULT_TILE_SIZE)
+            : size_(size),
+              tile_size_(tile_size)
+        {
+            init_tiles();
+            fill(value);
+        }
+
+        explicit SharedArray2D(const ArrayView2D<T>& values,
+                               Size2D<size_t> tile_size = DEFAULT_TILE_SIZE)
+            : size_(values.dimensions()),
+              tile_size_(tile_size)
+        {
+            init_tiles();
+            auto& tiles = *tiles_;
+            for (size_t i = 0; i < tile_counts_.rows; ++i)
+            {
+                for (size_t j = 0; j < tile_counts_.columns; ++j)
+                {
+                    const auto extent = get_tile_extent({i, j});
+                    tiles[i * tile_counts_.columns + j] = make_tile(
+                        values.subarray(extent));
+                }
+            }
+        }
+
+        [[nodiscard]]
+        const T& operator[](Index2D<size_t> index) const noexcept
+        {
+            const auto& tile = get_tile(index.row / tile_size_.rows,
+                                        index.column / tile_size_.columns);
+            return tile[{index.row % tile_size_.rows,
+                         index.column % tile_size_.columns}];
+        }
+
+        /**
+         * @brief Sets the value at @a index, duplicating its tile first
+         *  if it is shared with another array.
+         */
+        void set(Index2D<size_t> index, const T& value)
+        {
+            auto& tile = get_mutable_tile(index.row / tile_size_.rows,
+                                          index.column / tile_size_.columns);
+            tile[{index.row % tile_size_.rows,
+                  index.column % tile_size_.columns}] = value;
+        }
+
+        /**
+         * @brief Copies @a values into the array, with the top-left value
+         *  at @a origin.
+         *
+         * Only the tiles that overlap the destination are duplicated.
+         * Values that fall outside the array are ignored.
+         */
+        void write(Index2D<size_t> origin, const ArrayView2D<T>& values)
+        {
+            const auto extent = clamp(Extent2D<size_t>{origin, values.dimensions()}, size_);
+            if (is_empty(extent))
+                return;
+
+            const auto end = extent.origin + extent.size;
+            for (size_t i = extent.origin.row / tile_size_.rows;
+                 i * tile_size_.rows < end.row; ++i)
+            {
+                for (size_t j = extent.origin.column / tile_size_.columns;
+                     j * tile_size_.columns < end.column; ++j)
+                {
+                    const auto tile_extent = get_tile_extent({i, j});
+                    const auto overlap = get_intersection(tile_extent, extent);
+                    if (!overlap || is_empty(*overlap))
+                        continue;
+
+                    auto& tile = get_mutable_tile(i, j);
+                    copy_values(values.subarray({overlap->origin - origin,
+                                                 overlap->size}),
+                                tile.subarray({overlap->origin - tile_extent.origin,
+                                               overlap->size}));
+                }
+            }
+        }
+
+        /**
+         * @brief Sets all values to @a value.
+         *
+         * All the tiles with the same dimensions share the same memory
+         * afterwards.
+         */
+        void fill(const T& value)
+        {
+            detach_table();
+            std::shared_ptr<Array2D<T>> full_tile;
+            for (size_t i = 0; i < tile_counts_.rows; ++i)
+            {
+                for (size_t j = 0; j < tile_counts_.columns; ++j)
+                {
+                    const auto extent = get_tile_extent({i, j});
+                    auto& tile = (*tiles_)[i * tile_counts_.columns + j];
+                    if (extent.size == tile_size_)
+                    {
+                        if (!full_tile)
+                        {
+                            full_tile = std::make_shared<Array2D<T>>(tile_size_);
+                            full_tile->fill(value);
+                        }
+                        tile = full_tile;
+                    }
+                    else
+                    {
+                        tile = std::make_shared<Array2D<T>>(extent.size);
+                        tile->fill(value);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Returns a read-only view of the tile at row @a index.row
+         *  and column @a index.column in the grid of tiles.
+         */
+        [[nodiscard]]
+        ArrayView2D<T> tile(Index2D<size_t> index) const
+        {
+            assert_tile_index(index);
+            return get_tile(index.row, index.column).view();
+        }
+
+        /**
+         * @brief Returns a mutable view of a tile, duplicating the tile
+         *  first if it is shared with another array.
+         *
+         * The view is invalidated when the array is copied.
+         */
+        [[nodiscard]]
+        MutableArrayView2D<T> mutable_tile(Index2D<size_t> index)
+        {
+            assert_tile_index(index);
+            return get_mutable_tile(index.row, index.column).mut();
+        }
+
+        /**
+         * @brief Returns true if the tile at @a index uses the same
+         *  memory as the corresponding tile in @a other.
+         */
+        [[nodiscard]]
+        bool shares_tile(const SharedArray2D& other, Index2D<size_t> index) const
+        {
+            assert_tile_index(index);
+            return other.tile_counts_ == tile_counts_
+                   && other.tile_size_ == tile_size_
+                   && &get_tile(index.row, index.column)
+                      == &other.get_tile(index.row, index.column);
+        }
+
+        /**
+         * @brief Copies all values to @a dst.
+         */
+        void copy_to(const MutableArrayView2D<T>& dst) const
+        {
+            if (dst.dimensions() != size_)
+                CHORASMIA_THROW("dst has incorrect dimensions.");
+
+            for (size_t i = 0; i < tile_counts_.rows; ++i)
+            {
+                for (size_t j = 0; j < tile_counts_.columns; ++j)
+                {
+                    copy_values(get_tile(i, j).view(),
+                                dst.subarray(get_tile_extent({i, j})));
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Array2D<T> to_array() const
+        {
+            Array2D<T> result(size_);
+            copy_to(result.mut());
+            return result;
+        }
+
+        [[nodiscard]]
+        constexpr Size2D<size_t> dimensions() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]]
+        constexpr size_t row_count() const noexcept
+        {
+            return size_.rows;
+        }
+
+        [[nodiscard]]
+        constexpr size_t col_count() const noexcept
+        {
+            return size_.columns;
+        }
+
+        [[nodiscard]]
+        constexpr size_t value_count() const noexcept
+        {
+            return size_.rows * size_.columns;
+        }
+
+        [[nodiscard]]
+        constexpr Size2D<size_t> tile_size() const noexcept
+        {
+            return tile_size_;
+        }
+
+        /**
+         * @brief The number of rows and columns in the grid of tiles.
+         */
+        [[nodiscard]]
+        constexpr Size2D<size_t> tile_counts() const noexcept
+        {
+            return tile_counts_;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(const SharedArray2D& a, const SharedArray2D& b)
+        {
+            if (a.size_ != b.size_)
+                return false;
+            if (a.tiles_ == b.tiles_)
+                return true;
+            return a.to_array() == b.to_array();
+        }
+
+        [[nodiscard]]
+        friend bool operator!=(const SharedArray2D& a, const SharedArray2D& b)
+        {
+            return !(a == b);
+        }
+
+    private:
+        using TilePtr = std::shared_ptr<Array2D<T>>;
+        using TileTable = std::vector<TilePtr>;
+
+        // use_count() is a relaxed load. The fence makes sure the other
+        // owner's last reads happen before our writes once it has let go.
+        template <typename Ptr>
+        static bool is_unique(const Ptr& ptr) noexcept
+        {
+            if (ptr.use_count() != 1)
+                return false;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+
+        static void copy_values(const ArrayView2D<T>& src,
+                                const MutableArrayView2D<T>& dst)
+        {
+            transform(src, dst, [](const T& v) {return v;});
+        }
+
+        static TilePtr make_tile(const ArrayView2D<T>& values)
+        {
+            auto tile = std::make_shared<Array2D<T>>(values.dimensions());
+            copy_values(values, tile->mut());
+            return tile;
+        }
+
+        void init_tiles()
+        {
+            if (tile_size_.rows == 0 || tile_size_.columns == 0)
+                CHORASMIA_THROW("tile_size can not be zero.");
+            tile_counts_ = {(size_.rows + tile_size_.rows - 1) / tile_size_.rows,
+                            (size_.columns + tile_size_.columns - 1) / tile_size_.columns};
+            tiles_ = std::make_shared<TileTable>(tile_counts_.rows * tile_counts_.columns);
+        }
+
+        void assert_tile_index(Index2D<size_t> index) const
+        {
+            if (index.row >= tile_counts_.rows || index.column >= tile_counts_.columns)
+            {
+                CHORASMIA_THROW("Tile index (" + std::to_string(index.row)
+                                + ", " + std::to_string(index.column)
+                                + ") is out of range.");
+            }
+        }
+
+        [[nodiscard]]
+        Extent2D<size_t> get_tile_extent(Index2D<size_t> index) const
+        {
+            const Index2D<size_t> origin(index.row * tile_size_.rows,
+                                         index.column * tile_size_.columns);
+            return clamp(Extent2D<size_t>{origin, tile_size_}, size_);
+        }
+
+        [[nodiscard]]
+        const Array2D<T>& get_tile(size_t row, size_t column) const noexcept
+        {
+            return *(*tiles_)[row * tile_counts_.columns + column];
+        }
+
+        void detach_table()
+        {
+            if (!tiles_)
+                return;
+            if (!is_unique(tiles_))
+                tiles_ = std::make_shared<TileTable>(*tiles_);
+        }
+
+        Array2D<T>& get_mutable_tile(size_t row, size_t column)
+        {
+            detach_table();
+            auto& tile = (*tiles_)[row * tile_counts_.columns + column];
+            if (!is_unique(tile))
+                tile = make_tile(tile->view());
+            return *tile;
+        }
+
+        Size2D<size_t> size_;
+        Size2D<size_t> tile_size_ = DEFAULT_TILE_SIZE;
+        Size2D<size_t> tile_counts_;
+        std::shared_ptr<TileTable> tiles_;
+    };
+}
@@ -0,0 +1,448 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "ChorasmiaException.hpp"
+#include "SpscRingBuffer.hpp"
+
+namespace Chorasmia
+{
+    namespace Detail
+    {
+        // The layout at the start of the shared memory segment. It only
+        // contains fixed-size types so that processes built by different
+        // compilers agree on it.
+        struct SharedRingBufferHeader
+        {
+            static constexpr uint64_t MAGIC = 0x4348'4F52'5350'5343; // "CHORSPSC"
+            static constexpr uint32_t VERSION = 1;
+
+            uint64_t magic;
+            uint32_t version;
+            uint32_t record_size;
+            uint32_t capacity;
+
+            // Written by the producer.
+            alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> tail;
+            std::atomic<uint32_t> producer_waiting;
+
+            // Written by the consumer.
+            alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> head;
+            std::atomic<uint32_t> consumer_waiting;
+        };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free);
+        static_assert(sizeof(SharedRingBufferHeader) % CACHE_LINE_SIZE == 0);
+
+        // std::atomic::wait uses private futexes, which only work within
+        // a process, so the shared buffer calls futex directly.
+        inline void futex_wait(std::atomic<uint32_t>& word, uint32_t value) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word),
+                    FUTEX_WAIT, value, nullptr, nullptr, 0);
+        }
+
+        inline void futex_wake(std::atomic<uint32_t>& word) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word),
+                    FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+        }
+
+        [[noreturn]]
+        inline void throw_shm_error(const char* function, const std::string& name)
+        {
+            CHORASMIA_THROW("Call to " + std::string(function) + " for \""
+                            + name + "\" failed: " + std::strerror(errno));
+        }
+    }
+
+    /**
+     * @brief A queue for one producer process and one consumer process
+     *  in a POSIX shared memory segment.
+     *
+     * One process creates the segment with create() and the other
+     * attaches to it with open(). The segment starts with a fixed header
+     * that holds the record size, capacity and the head and tail indices
+     * on separate cache lines, followed by the records.
+     *
+     * The indices are 32-bit counters that wrap around, and the capacity
+     * is a power of two, so tail - head is always the size. They are
+     * updated with release stores and read with acquire loads, exactly
+     * like SpscRingBuffer. The blocking functions push and pop sleep on
+     * the index with a shared futex, and the other side only makes the
+     * futex system call when the waiting flag says someone is asleep.
+     *
+     * T must be trivially copyable, as it is copied byte by byte
+     * between processes.
+     */
+    template <typename T>
+    class SharedMemoryRingBuffer
+    {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "T must be trivially copyable.");
+
+        SharedMemoryRingBuffer() = default;
+
+        SharedMemoryRingBuffer(const SharedMemoryRingBuffer&) = delete;
+
+        SharedMemoryRingBuffer(SharedMemoryRingBuffer&& other) noexcept
+            : header_(std::exchange(other.header_, nullptr)),
+              records_(std::exchange(other.records_, nullptr)),
+              mapping_size_(std::exchange(other.mapping_size_, 0))
+        {}
+
+        ~SharedMemoryRingBuffer()
+        {
+            if (header_)
+                munmap(header_, mapping_size_);
+        }
+
+        SharedMemoryRingBuffer& operator=(const SharedMemoryRingBuffer&) = delete;
+
+        SharedMemoryRingBuffer& operator=(SharedMemoryRingBuffer&& other) noexcept
+        {
+            std::swap(header_, other.header_);
+            std::swap(records_, other.records_);
+            std::swap(mapping_size_, other.mapping_size_);
+            return *this;
+        }
+
+        /**
+         * @brief Creates a new shared memory segment named @a name with
+         *  room for at least @a min_capacity records.
+         *
+         * @a name must follow the rules for shm_open, i.e. start with a
+         * slash. Fails if the segment already exists. The segment
+         * remains until unlink() is called, even after all processes
+         * have closed it.
+         */
+        [[nodiscard]]
+        static SharedMemoryRingBuffer create(const std::string& name,
+                                             size_t min_capacity)
+        {
+            if (min_capacity == 0 || min_capacity > MAX_CAPACITY)
+                CHORASMIA_THROW("Invalid capacity: " + std::to_string(min_capacity));
+
+            const auto capacity = std::bit_ceil(uint32_t(min_capacity));
+            const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd == -1)
+                Detail::throw_shm_error("shm_open", name);
+
+            const auto size = get_mapping_size(capacity);
+            if (ftruncate(fd, off_t(size)) == -1)
+            {
+                close(fd);
+                shm_unlink(name.c_str());
+                Detail::throw_shm_error("ftruncate", name);
+            }
+
+            SharedMemoryRingBuffer result;
+            try
+            {
+                result.map(fd, size, name);
+            }
+            catch (...)
+            {
+                shm_unlink(name.c_str());
+                throw;
+            }
+            // A new segment is zero-filled, so the indices and flags
+            // start out as 0. The header fields are written before the
+            // magic number, which tells open() the segment is ready.
+            auto& header = *result.header_;
+            header.version = Detail::SharedRingBufferHeader::VERSION;
+            header.record_size = sizeof(T);
+            header.capacity = capacity;
+            std::atomic_ref(header.magic).store(
+                Detail::SharedRingBufferHeader::MAGIC, std::memory_order_release);
+            return result;
+        }
+
+        /**
+         * @brief Opens the existing shared memory segment @a name.
+         *
+         * Throws if the segment wasn't created by create() with the same
+         * record size, or if its header is corrupt.
+         */
+        [[nodiscard]]
+        static SharedMemoryRingBuffer open(const std::string& name)
+        {
+            const int fd = shm_open(name.c_str(), O_RDWR, 0);
+            if (fd == -1)
+                Detail::throw_shm_error("shm_open", name);
+
+            struct stat st = {};
+            if (fstat(fd, &st) == -1)
+            {
+                close(fd);
+                Detail::throw_shm_error("fstat", name);
+            }
+            if (size_t(st.st_size) < sizeof(Header))
+            {
+                close(fd);
+                CHORASMIA_THROW("\"" + name + "\" is too small to be a ring buffer.");
+            }
+
+            SharedMemoryRingBuffer result;
+            result.map(fd, size_t(st.st_size), name);
+            const auto& header = *result.header_;
+            if (std::atomic_ref(result.header_->magic).load(std::memory_order_acquire)
+                    != Detail::SharedRingBufferHeader::MAGIC
+                || header.version != Detail::SharedRingBufferHeader::VERSION
+                || !std::has_single_bit(header.capacity))
+            {
+                CHORASMIA_THROW("\"" + name + "\" is not a ring buffer.");
+            }
+            if (header.record_size != sizeof(T))
+            {
+                CHORASMIA_THROW("\"" + name + "\" has records of size "
+                                + std::to_string(header.record_size)
+                                + ", expected " + std::to_string(sizeof(T)) + ".");
+            }
+            if (get_mapping_size(header.capacity) > result.mapping_size_)
+                CHORASMIA_THROW("\"" + name + "\" is truncated.");
+            return result;
+        }
+
+        /**
+         * @brief Removes the name @a name. The memory is freed when the
+         *  last process that uses it unmaps it.
+         */
+        static void unlink(const std::string& name)
+        {
+            if (shm_unlink(name.c_str()) == -1)
+                Detail::throw_shm_error("shm_unlink", name);
+        }
+
+        /**
+         * @brief Adds @a value to the queue unless it is full.
+         *
+         * Must only be called by the producer.
+         */
+        bool try_push(const T& value)
+        {
+            return try_push(std::span<const T>(&value, 1)) == 1;
+        }
+
+        /**
+         * @brief Adds as many of @a values as there is room for.
+         *
+         * Must only be called by the producer.
+         * @return The number of values that were added.
+         */
+        size_t try_push(std::span<const T> values)
+        {
+            auto& h = *header_;
+            const auto tail = h.tail.load(std::memory_order_relaxed);
+            const auto head = h.head.load(std::memory_order_acquire);
+            const auto count = std::min<size_t>(capacity() - (tail - head),
+                                                values.size());
+            if (count == 0)
+                return 0;
+
+            const auto index = tail & (capacity() - 1);
+            const auto first = std::min<size_t>(count, capacity() - index);
+            std::copy_n(values.begin(), first, records_ + index);
+            std::copy_n(values.begin() + first, count - first, records_);
+            publish(h.tail, tail + uint32_t(count), h.consumer_waiting);
+            return count;
+        }
+
+        /**
+         * @brief Adds @a value to the queue, waiting for room if it is
+         *  full.
+         *
+         * Must only be called by the producer.
+         */
+        void push(const T& value)
+        {
+            auto& h = *header_;
+            while (!try_push(value))
+            {
+                const auto head = h.head.load(std::memory_order_acquire);
+                wait_while(h.head, head, h.producer_waiting, [&]
+                {
+                    return h.tail.load(std::memory_order_relaxed) - head
+                           == capacity();
+                });
+            }
+        }
+
+        /**
+         * @brief Copies the value at the front of the queue to @a value
+         *  and removes it, unless the queue is empty.
+         *
+         * Must only be called by the consumer.
+         */
+        bool try_pop(T& value)
+        {
+            return try_pop(std::span<T>(&value, 1)) == 1;
+        }
+
+        /**
+         * @brief Moves up to values.size() values from the front of the
+         *  queue to @a values.
+         *
+         * Must only be called by the consumer.
+         * @return The number of values that were removed.
+         */
+        size_t try_pop(std::span<T> values)
+        {
+            auto& h = *header_;
+            const auto head = h.head.load(std::memory_order_relaxed);
+            const auto tail = h.tail.load(std::memory_order_acquire);
+            const auto count = std::min<size_t>(tail - head, values.size());
+            if (count == 0)
+                return 0;
+
+            const auto index = head & (capacity() - 1);
+            const auto first = std::min<size_t>(count, capacity() - index);
+            std::copy_n(records_ + index, first, values.begin());
+            std::copy_n(records_, count - first, values.begin() + first);
+            publish(h.head, head + uint32_t(count), h.producer_waiting);
+            return count;
+        }
+
+        /**
+         * @brief Copies the value at the front of the queue to @a value
+         *  and removes it, waiting for a value if the queue is empty.
+         *
+         * Must only be called by the consumer.
+         */
+        void pop(T& value)
+        {
+            auto& h = *header_;
+            while (!try_pop(value))
+            {
+                const auto tail = h.tail.load(std::memory_order_acquire);
+                wait_while(h.tail, tail, h.consumer_waiting, [&]
+                {
+                    return h.head.load(std::memory_order_relaxed) == tail;
+                });
+            }
+        }
+
+        /**
+         * @brief Removes and returns the value at the front of the
+         *  queue, waiting for a value if it is empty.
+         *
+         * Must only be called by the consumer. Types that aren't
+         * default constructible can use pop(T&) instead.
+         */
+        [[nodiscard]]
+        T pop() requires std::is_default_constructible_v<T>
+        {
+            T value;
+            pop(value);
+            return value;
+        }
+
+        /**
+         * @brief Returns the number of values in the queue.
+         *
+         * The result is only exact when neither process is modifying
+         * the queue.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            const auto head = header_->head.load(std::memory_order_acquire);
+            const auto tail = header_->tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        size_t capacity() const noexcept
+        {
+            return header_ ? header_->capacity : 0;
+        }
+
+    private:
+        using Header = Detail::SharedRingBufferHeader;
+
+        static constexpr size_t MAX_CAPACITY = size_t(1) << 31;
+
+        static size_t get_mapping_size(size_t capacity)
+        {
+            const auto records_offset = (sizeof(Header) + alignof(T) - 1)
+                                        / alignof(T) * alignof(T);
+            return records_offset + capacity * sizeof(T);
+        }
+
+        void map(int fd, size_t size, const std::string& name)
+        {
+            void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED, fd, 0);
+            close(fd);
+            if (memory == MAP_FAILED)
+                Detail::throw_shm_error("mmap", name);
+
+            header_ = static_cast<Header*>(memory);
+            mapping_size_ = size;
+            records_ = reinterpret_cast<T*>(static_cast<std::byte*>(memory)
+                                            + get_mapping_size(0));
+        }
+
+        // The seq_cst operations here and in wait_while make sure that
+        // either the waiting side sees the new index before it sleeps,
+        // or this side sees the waiting flag and wakes it.
+        static void publish(std::atomic<uint32_t>& index, uint32_t value,
+                            std::atomic<uint32_t>& other_waiting) noexcept
+        {
+            index.store(value, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (other_waiting.load(std::memory_order_relaxed) != 0)
+                Detail::futex_wake(index);
+        }
+
+        template <typename Pred>
+        static void wait_while(std::atomic<uint32_t>& index, uint32_t value,
+                               std::atomic<uint32_t>& waiting,
+                               Pred still_blocked) noexcept
+        {
+            if (!still_blocked())
+                return;
+            waiting.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (index.load(std::memory_order_relaxed) == value)
+                Detail::futex_wait(index, value);
+            waiting.store(0, std::memory_order_relaxed);
+        }
+
+        Header* header_ = nullptr;
+        T* records_ = nullptr;
+        size_t mapping_size_ = 0;
+    };
+}
+
+#endif
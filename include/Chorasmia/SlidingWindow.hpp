@@ -0,0 +1,288 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "RingBuffer.hpp"
+
+namespace Chorasmia
+{
+    /**
+     * @brief Tags that select the aggregates a SlidingWindow maintains.
+     */
+    struct WindowSum {};
+    struct WindowMean {};
+    struct WindowVariance {};
+    struct WindowMin {};
+    struct WindowMax {};
+
+    namespace Detail
+    {
+        template <int I>
+        struct NoAggregate {};
+
+        template <typename Tag, typename... Tags>
+        constexpr bool HAS_AGGREGATE = (std::is_same_v<Tag, Tags> || ...);
+
+        // A monotonic deque: the values that can still become the
+        // window's minimum (or maximum with Compare = std::greater),
+        // paired with their sequence numbers. The front is the current
+        // extreme.
+        template <typename T, unsigned N, typename Compare>
+        class MonotonicDeque
+        {
+        public:
+            void push(size_t seq, const T& value)
+            {
+                if (!values_.empty() && values_.front().first + N <= seq)
+                    values_.pop_front();
+                while (!values_.empty() && !Compare()(values_.back().second, value))
+                    values_.pop_back();
+                values_.emplace_back(seq, value);
+            }
+
+            [[nodiscard]]
+            const T& front() const
+            {
+                return values_.front().second;
+            }
+
+            void clear()
+            {
+                values_.clear();
+            }
+
+        private:
+            RingBuffer<std::pair<size_t, T>, N> values_;
+        };
+
+        // The running mean and sum of squared differences from the mean
+        // (Welford's algorithm, extended to removals).
+        template <typename R>
+        struct WelfordState
+        {
+            void add(R value, size_t new_count)
+            {
+                const auto delta = value - mean;
+                mean += delta / R(new_count);
+                m2 += delta * (value - mean);
+            }
+
+            void remove(R value, size_t new_count)
+            {
+                if (new_count == 0)
+                {
+                    *this = {};
+                    return;
+                }
+                const auto delta = value - mean;
+                mean -= delta / R(new_count);
+                m2 -= delta * (value - mean);
+                // Rounding errors can make m2 slightly negative.
+                if (m2 < 0)
+                    m2 = 0;
+            }
+
+            R mean = 0;
+            R m2 = 0;
+        };
+    }
+
+    /**
+     * @brief The last @a N values that were pushed, with aggregates that
+     *  are updated in O(1) amortized time per push.
+     *
+     * @a Aggregates is any combination of WindowSum, WindowMean,
+     * WindowVariance, WindowMin and WindowMax, and only the functions
+     * for the selected aggregates are available. Aggregates that aren't
+     * selected take no space and no time.
+     *
+     * - Sum keeps a running total in T. With floating point values it
+     *   accumulates rounding errors over long runs.
+     * - Variance uses Welford's algorithm, which is numerically stable,
+     *   and also provides mean().
+     * - Min and max use monotonic deques, each holding at most @a N
+     *   values.
+     *
+     * Example:
+     * @code
+     * SlidingWindow<double, 64, WindowMean, WindowMax> window;
+     * for (auto sample : samples)
+     * {
+     *     window.push(sample);
+     *     report(window.mean(), window.max());
+     * }
+     * @endcode
+     */
+    template <typename T, unsigned N, typename... Aggregates>
+    class SlidingWindow
+    {
+    public:
+        static constexpr bool HAS_SUM = Detail::HAS_AGGREGATE<WindowSum, Aggregates...>;
+        static constexpr bool HAS_MEAN = Detail::HAS_AGGREGATE<WindowMean, Aggregates...>;
+        static constexpr bool HAS_VARIANCE = Detail::HAS_AGGREGATE<WindowVariance, Aggregates...>;
+        static constexpr bool HAS_MIN = Detail::HAS_AGGREGATE<WindowMin, Aggregates...>;
+        static constexpr bool HAS_MAX = Detail::HAS_AGGREGATE<WindowMax, Aggregates...>;
+
+        /**
+         * @brief The type of mean() and variance(): T if it is a floating
+         *  point type, double otherwise.
+         */
+        using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+        /**
+         * @brief Adds @a value to the window, removing the oldest value
+         *  if the window is full.
+         */
+        void push(const T& value)
+        {
+            if (values_.size() == N)
+            {
+                const auto& oldest = values_.front();
+                if constexpr (KEEPS_SUM)
+                    sum_ -= oldest;
+                if constexpr (HAS_VARIANCE)
+                    welford_.remove(Real(oldest), N - 1);
+            }
+
+            values_.push_back(value);
+
+            if constexpr (KEEPS_SUM)
+                sum_ += value;
+            if constexpr (HAS_VARIANCE)
+                welford_.add(Real(value), values_.size());
+            if constexpr (HAS_MIN)
+                min_.push(seq_, value);
+            if constexpr (HAS_MAX)
+                max_.push(seq_, value);
+            ++seq_;
+        }
+
+        void clear()
+        {
+            values_.clear();
+            seq_ = 0;
+            if constexpr (KEEPS_SUM)
+                sum_ = T();
+            if constexpr (HAS_VARIANCE)
+                welford_ = {};
+            if constexpr (HAS_MIN)
+                min_.clear();
+            if constexpr (HAS_MAX)
+                max_.clear();
+        }
+
+        [[nodiscard]]
+        const RingBuffer<T, N>& values() const noexcept
+        {
+            return values_;
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            return values_.size();
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return values_.empty();
+        }
+
+        [[nodiscard]]
+        static constexpr size_t capacity() noexcept
+        {
+            return N;
+        }
+
+        [[nodiscard]]
+        T sum() const requires HAS_SUM
+        {
+            return sum_;
+        }
+
+        /**
+         * @brief Returns the mean of the values in the window, or 0 if
+         *  it is empty.
+         */
+        [[nodiscard]]
+        Real mean() const requires (HAS_MEAN || HAS_VARIANCE)
+        {
+            if constexpr (HAS_VARIANCE)
+                return welford_.mean;
+            else
+                return values_.empty() ? Real(0) : Real(sum_) / Real(values_.size());
+        }
+
+        /**
+         * @brief Returns the population variance of the values in the
+         *  window, or 0 if it is empty.
+         */
+        [[nodiscard]]
+        Real variance() const requires HAS_VARIANCE
+        {
+            return values_.empty() ? Real(0) : welford_.m2 / Real(values_.size());
+        }
+
+        /**
+         * @brief Returns the sample variance of the values in the
+         *  window, or 0 if it has fewer than two values.
+         */
+        [[nodiscard]]
+        Real sample_variance() const requires HAS_VARIANCE
+        {
+            return values_.size() < 2 ? Real(0) : welford_.m2 / Real(values_.size() - 1);
+        }
+
+        /**
+         * @brief Returns the smallest value in the window.
+         *
+         * The window must not be empty.
+         */
+        [[nodiscard]]
+        const T& min() const requires HAS_MIN
+        {
+            return min_.front();
+        }
+
+        /**
+         * @brief Returns the largest value in the window.
+         *
+         * The window must not be empty.
+         */
+        [[nodiscard]]
+        const T& max() const requires HAS_MAX
+        {
+            return max_.front();
+        }
+
+    private:
+        // Mean without variance is computed from the sum.
+        static constexpr bool KEEPS_SUM = HAS_SUM || (HAS_MEAN && !HAS_VARIANCE);
+
+        RingBuffer<T, N> values_;
+        // The number of values pushed since the window was created or
+        // cleared. The monotonic deques use it to tell when their
+        // front value has left the window.
+        size_t seq_ = 0;
+        [[no_unique_address]]
+        std::conditional_t<KEEPS_SUM, T, Detail::NoAggregate<0>> sum_{};
+        [[no_unique_address]]
+        std::conditional_t<HAS_VARIANCE, Detail::WelfordState<Real>,
+                           Detail::NoAggregate<1>> welford_;
+        [[no_unique_address]]
+        std::conditional_t<HAS_MIN, Detail::MonotonicDeque<T, N, std::less<T>>,
+                           Detail::NoAggregate<2>> min_;
+        [[no_unique_address]]
+        std::conditional_t<HAS_MAX, Detail::MonotonicDeque<T, N, std::greater<T>>,
+                           Detail::NoAggregate<3>> max_;
+    };
+}
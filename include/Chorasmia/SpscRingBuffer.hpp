@@ -0,0 +1,184 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+namespace Chorasmia
+{
+    namespace Detail
+    {
+        // std::hardware_destructive_interference_size triggers warnings
+        // in GCC when used in headers, and 64 bytes is right for x86-64
+        // and most ARM cores.
+        constexpr size_t CACHE_LINE_SIZE = 64;
+    }
+
+    /**
+     * @brief A fixed-capacity lock-free queue for one producer thread and
+     *  one consumer thread.
+     *
+     * The producer calls try_push, the consumer calls try_pop. Neither
+     * blocks or allocates; they return false or a short count when the
+     * queue is full or empty.
+     *
+     * The producer's and consumer's indices are on separate cache lines.
+     * Each side also keeps a cached copy of the other side's index and
+     * only reloads it when the cached value says the queue is full (or
+     * empty), so in the steady state neither side touches the other's
+     * cache line.
+     *
+     * A power of two for @a N makes the index computations cheaper.
+     */
+    template <typename T, unsigned N>
+    class SpscRingBuffer
+    {
+    public:
+        static_assert(N > 0, "N must be greater than 0.");
+
+        SpscRingBuffer() = default;
+
+        SpscRingBuffer(const SpscRingBuffer&) = delete;
+
+        SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+        /**
+         * @brief Adds @a value to the queue unless it is full.
+         *
+         * Must only be called by the producer.
+         */
+        bool try_push(T value)
+        {
+            const auto tail = tail_.load(std::memory_order_relaxed);
+            if (tail - producer_head_ == N)
+            {
+                producer_head_ = head_.load(std::memory_order_acquire);
+                if (tail - producer_head_ == N)
+                    return false;
+            }
+
+            values_[tail % N] = std::move(value);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Adds as many of @a values as there is room for.
+         *
+         * Must only be called by the producer.
+         * @return The number of values that were added.
+         */
+        size_t try_push(std::span<const T> values)
+        {
+            const auto tail = tail_.load(std::memory_order_relaxed);
+            if (N - (tail - producer_head_) < values.size())
+                producer_head_ = head_.load(std::memory_order_acquire);
+
+            const auto count = std::min<size_t>(N - (tail - producer_head_),
+                                                values.size());
+            if (count == 0)
+                return 0;
+
+            const auto index = tail % N;
+            const auto first = std::min<size_t>(count, N - index);
+            std::copy_n(values.begin(), first, values_ + index);
+            std::copy_n(values.begin() + first, count - first, values_);
+            tail_.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Moves the value at the front of the queue to @a value
+         *  unless the queue is empty.
+         *
+         * Must only be called by the consumer.
+         */
+        bool try_pop(T& value)
+        {
+            const auto head = head_.load(std::memory_order_relaxed);
+            if (head == consumer_tail_)
+            {
+                consumer_tail_ = tail_.load(std::memory_order_acquire);
+                if (head == consumer_tail_)
+                    return false;
+            }
+
+            value = std::move(values_[head % N]);
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Moves up to values.size() values from the front of the
+         *  queue to @a values.
+         *
+         * Must only be called by the consumer.
+         * @return The number of values that were removed.
+         */
+        size_t try_pop(std::span<T> values)
+        {
+            const auto head = head_.load(std::memory_order_relaxed);
+            if (consumer_tail_ - head < values.size())
+                consumer_tail_ = tail_.load(std::memory_order_acquire);
+
+            const auto count = std::min<size_t>(consumer_tail_ - head,
+                                                values.size());
+            if (count == 0)
+                return 0;
+
+            const auto index = head % N;
+            const auto first = std::min<size_t>(count, N - index);
+            std::move(values_ + index, values_ + index + first, values.begin());
+            std::move(values_, values_ + (count - first), values.begin() + first);
+            head_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Returns the number of values in the queue.
+         *
+         * The result is only exact when neither thread is modifying the
+         * queue.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            const auto head = head_.load(std::memory_order_acquire);
+            const auto tail = tail_.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        static constexpr size_t capacity() noexcept
+        {
+            return N;
+        }
+
+    private:
+        // The indices count all values ever pushed and popped, so
+        // tail - head is the size even after they wrap around.
+
+        // Written by the producer.
+        alignas(Detail::CACHE_LINE_SIZE) std::atomic<size_t> tail_ = 0;
+        size_t producer_head_ = 0;
+
+        // Written by the consumer.
+        alignas(Detail::CACHE_LINE_SIZE) std::atomic<size_t> head_ = 0;
+        size_t consumer_tail_ = 0;
+
+        alignas(Detail::CACHE_LINE_SIZE) T values_[N];
+    };
+}
@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Chorasmia/Array2D.hpp"
+#include <cstdlib>
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("Add rows to Array2D")
@@ -75,3 +76,59 @@ TEST_CASE("Iterate over an Array2D")
         }
     }
 }
+
+TEST_CASE("Array2D with external buffer and deleter")
+{
+    auto* values = static_cast<int*>(std::malloc(6 * sizeof(int)));
+    for (int i = 0; i < 6; ++i)
+        values[i] = i + 1;
+
+    int deleted = 0;
+    {
+        Chorasmia::Array2D<int> a(values, {2, 3}, [&](int* p)
+        {
+            ++deleted;
+            std::free(p);
+        });
+        REQUIRE(a.has_external_buffer());
+        REQUIRE(a.data() == values);
+        REQUIRE(a[{1, 2}] == 6);
+        a.mut()[{0, 0}] = 10;
+        REQUIRE(values[0] == 10);
+
+        auto b = std::move(a);
+        REQUIRE(b.data() == values);
+        REQUIRE(a.empty());
+
+        auto c = b;
+        REQUIRE_FALSE(c.has_external_buffer());
+        REQUIRE(c.data() != values);
+        REQUIRE(c == b);
+        REQUIRE(deleted == 0);
+    }
+    REQUIRE(deleted == 1);
+}
+
+TEST_CASE("Array2D with shared owner")
+{
+    auto owner = std::make_shared<std::vector<int>>(std::vector<int>{1, 2, 3, 4});
+    Chorasmia::Array2D<int> a(owner->data(), {2, 2}, owner);
+    REQUIRE(owner.use_count() == 2);
+    REQUIRE(a.view().row(1)[0] == 3);
+
+    auto values = a.release();
+    REQUIRE(values == std::vector<int>{1, 2, 3, 4});
+    REQUIRE(a.empty());
+    REQUIRE(owner.use_count() == 1);
+}
+
+TEST_CASE("Resize Array2D with external buffer")
+{
+    std::vector<int> values{1, 2, 3, 4};
+    Chorasmia::Array2D<int> a(values.data(), {2, 2},
+                              [](int*) {});
+    a.resize({2, 3});
+    REQUIRE_FALSE(a.has_external_buffer());
+    REQUIRE(a == Chorasmia::Array2D<int>({1, 2, 0, 3, 4, 0}, {2, 3}));
+    REQUIRE(values == std::vector<int>{1, 2, 3, 4});
+}
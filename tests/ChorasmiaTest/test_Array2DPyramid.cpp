@@ -0,0 +1,164 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/Array2DPyramid.hpp>
+#include <climits>
+#include <Chorasmia/Array2D.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Array2DPyramid levels")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({
+                       1, 2, 3, 4, 5,
+                       6, 7, 8, 9, 10,
+                       11, 12, 13, 14, 15
+                   }, {3, 5});
+    Array2DPyramid<int> pyramid(a.view(), PyramidReduction::MAX);
+    REQUIRE(pyramid.level_count() == 4);
+    REQUIRE(pyramid.level_dimensions(0) == Size2D<size_t>(3, 5));
+    REQUIRE(pyramid.level_dimensions(1) == Size2D<size_t>(2, 3));
+    REQUIRE(pyramid.level_dimensions(2) == Size2D<size_t>(1, 2));
+    REQUIRE(pyramid.level_dimensions(3) == Size2D<size_t>(1, 1));
+    REQUIRE(pyramid.value_count() == 15 + 6 + 2 + 1);
+
+    REQUIRE(pyramid.level(0) == a.view());
+    Array2D<int> level1({7, 9, 10, 12, 14, 15}, {2, 3});
+    REQUIRE(pyramid.level(1) == level1.view());
+    Array2D<int> level2({14, 15}, {1, 2});
+    REQUIRE(pyramid.level(2) == level2.view());
+    REQUIRE(pyramid.level(3)[{0, 0}] == 15);
+    REQUIRE_THROWS_AS(pyramid.level_dimensions(4), ChorasmiaException);
+}
+
+TEST_CASE("Array2DPyramid reductions")
+{
+    using namespace Chorasmia;
+    Array2D<double> a({
+                          1, 2, 3,
+                          5, 6, 7,
+                          8, 9, 10
+                      }, {3, 3});
+
+    Array2DPyramid<double> mean(a.view(), PyramidReduction::MEAN);
+    Array2D<double> mean1({3.5, 5, 8.5, 10}, {2, 2});
+    REQUIRE(mean.level(1) == mean1.view());
+    REQUIRE(mean.level(2)[{0, 0}] == 6.75);
+
+    Array2DPyramid<double> min(a.view(), PyramidReduction::MIN);
+    Array2D<double> min1({1, 3, 8, 10}, {2, 2});
+    REQUIRE(min.level(1) == min1.view());
+    REQUIRE(min.level(2)[{0, 0}] == 1);
+}
+
+TEST_CASE("Array2DPyramid of a subarray")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({
+                       1, 2, 3, 4,
+                       5, 6, 7, 8,
+                       9, 10, 11, 12
+                   }, {3, 4});
+    auto sub = a.view().subarray({{1, 1}, {2, 2}});
+    Array2DPyramid<int> pyramid(sub, PyramidReduction::MIN);
+    REQUIRE(pyramid.level(0) == sub);
+    REQUIRE(pyramid.level(1)[{0, 0}] == 6);
+}
+
+TEST_CASE("Array2DPyramid lazy generation")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({
+                       4, 8, 1, 1,
+                       2, 2, 1, 1
+                   }, {2, 4});
+    Array2DPyramid<int> pyramid(a.view(), PyramidReduction::MEAN, 1);
+    REQUIRE(pyramid.is_generated(0));
+    REQUIRE_FALSE(pyramid.is_generated(1));
+
+    const auto& const_pyramid = pyramid;
+    REQUIRE_THROWS_AS(const_pyramid.generated_level(2), ChorasmiaException);
+
+    REQUIRE(pyramid.level(2)[{0, 0}] == 3);
+    REQUIRE(pyramid.is_generated(1));
+    REQUIRE(pyramid.is_generated(2));
+    Array2D<int> level1({4, 1}, {1, 2});
+    REQUIRE(const_pyramid.generated_level(1) == level1.view());
+}
+
+TEST_CASE("Array2DPyramid multi-threaded generation")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({1000, 700});
+    for (size_t i = 0; i < a.row_count(); ++i)
+    {
+        for (size_t j = 0; j < a.col_count(); ++j)
+            a[{i, j}] = int((i * 7919 + j * 104729) % 1000);
+    }
+
+    Array2DPyramid<int> single(a.view(), PyramidReduction::MEAN, SIZE_MAX, 1);
+    Array2DPyramid<int> multi(a.view(), PyramidReduction::MEAN, SIZE_MAX, 4);
+    REQUIRE(single.level_count() == multi.level_count());
+    for (size_t i = 0; i < single.level_count(); ++i)
+        REQUIRE(single.level(i) == multi.level(i));
+}
+
+TEST_CASE("Array2DPyramid levels generated in bands")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({300, 201});
+    for (size_t i = 0; i < a.row_count(); ++i)
+    {
+        for (size_t j = 0; j < a.col_count(); ++j)
+            a[{i, j}] = int((i * 7919 + j * 104729) % 1000);
+    }
+
+    // Levels 1 and 2 have at least 64 rows and are generated in bands
+    // of four base rows, the remaining levels in a second pass. Every
+    // value in level k is the maximum of a 2^k x 2^k block in level 0.
+    Array2DPyramid<int> pyramid(a.view(), PyramidReduction::MAX, 2, 4);
+    pyramid.generate_levels(SIZE_MAX);
+    for (size_t k = 1; k < pyramid.level_count(); ++k)
+    {
+        const auto level = pyramid.generated_level(k);
+        const auto block = size_t(1) << k;
+        size_t mismatches = 0;
+        for (size_t i = 0; i < level.row_count(); ++i)
+        {
+            for (size_t j = 0; j < level.col_count(); ++j)
+            {
+                int expected = INT_MIN;
+                for (size_t y = i * block; y < std::min((i + 1) * block, a.row_count()); ++y)
+                {
+                    for (size_t x = j * block; x < std::min((j + 1) * block, a.col_count()); ++x)
+                        expected = std::max(expected, a[{y, x}]);
+                }
+                if (level[{i, j}] != expected)
+                    ++mismatches;
+            }
+        }
+        REQUIRE(mismatches == 0);
+    }
+}
+
+TEST_CASE("Array2DPyramid map_extent")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({100, 60});
+    Array2DPyramid<int> pyramid(a.view(), PyramidReduction::MAX, 1);
+    REQUIRE(pyramid.level_dimensions(2) == Size2D<size_t>(25, 15));
+
+    using E = Extent2D<size_t>;
+    REQUIRE(pyramid.map_extent(E({5, 6}, {10, 3}), 0, 2)
+            == E({1, 1}, {3, 2}));
+    REQUIRE(pyramid.map_extent(E({1, 1}, {3, 2}), 2, 0)
+            == E({4, 4}, {12, 8}));
+    REQUIRE(pyramid.map_extent(E({20, 10}, {10, 10}), 2, 0)
+            == E({80, 40}, {20, 20}));
+    REQUIRE(pyramid.map_extent(E({20, 10}), 1, 2)
+            == E({10, 5}, {15, 10}));
+}
@@ -0,0 +1,80 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/ArrayExpression.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Evaluate arithmetic expression into Array2D")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({1, 2, 3, 4, 5, 6}, {2, 3});
+    Array2D<int> b({6, 5, 4, 3, 2, 1}, {2, 3});
+
+    Array2D<int> c = (a - b) * 2 + 1;
+    REQUIRE(c == Array2D<int>({-9, -5, -1, 3, 7, 11}, {2, 3}));
+
+    Array2D d = -a / 2.0;
+    REQUIRE(d == Array2D<double>({-0.5, -1, -1.5, -2, -2.5, -3}, {2, 3}));
+}
+
+TEST_CASE("Evaluate expression on views with row gaps")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({
+                       1, 2, 3, 4,
+                       5, 6, 7, 8,
+                       9, 10, 11, 12
+                   }, {3, 4});
+    Array2D<int> b({2, 2});
+    b.fill(100);
+
+    auto expr = a.view().subarray({{1, 2}, {2, 2}}) + b.view();
+    REQUIRE(expr.dimensions() == Size2D<size_t>(2, 2));
+
+    Array2D<int> c = expr;
+    REQUIRE(c == Array2D<int>({107, 108, 111, 112}, {2, 2}));
+
+    assign(a.subarray({{0, 0}, {2, 2}}), 10 * b - 1);
+    REQUIRE(a == Array2D<int>({
+                                  999, 999, 3, 4,
+                                  999, 999, 7, 8,
+                                  9, 10, 11, 12
+                              }, {3, 4}));
+}
+
+TEST_CASE("Assign expression to one of its operands")
+{
+    using namespace Chorasmia;
+    Array2D<float> a({1, 2, 3, 4}, {2, 2});
+    a = a * a + 1;
+    REQUIRE(a == Array2D<float>({2, 5, 10, 17}, {2, 2}));
+
+    Array2D<float> b;
+    b = a - 2;
+    REQUIRE(b == Array2D<float>({0, 3, 8, 15}, {2, 2}));
+}
+
+TEST_CASE("Custom array expression")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({1, 5, 9, 3}, {2, 2});
+    Array2D<int> b({4, 4, 4, 4}, {2, 2});
+    auto max = [](int x, int y) {return std::max(x, y);};
+    Array2D<int> c = make_array_expression(max, a, b) * 10;
+    REQUIRE(c == Array2D<int>({40, 50, 90, 40}, {2, 2}));
+}
+
+TEST_CASE("Expressions with mismatched dimensions")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({2, 3});
+    Array2D<int> b({3, 2});
+    REQUIRE_THROWS_AS(a + b, ChorasmiaException);
+
+    Array2D<int> c({3, 3});
+    REQUIRE_THROWS_AS(assign(c.mut(), a + 1), ChorasmiaException);
+}
@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Chorasmia/ArrayView2D.hpp"
+#include <algorithm>
 #include <numeric>
 #include <catch2/catch_test_macros.hpp>
 
@@ -80,3 +81,70 @@ TEST_CASE("ArrayView2D subarray indexing.")
     REQUIRE(sub2[{0, 0}] == a[6]);
     REQUIRE(sub2[{1, 1}] == a[11]);
 }
+
+TEST_CASE("ArrayView2D elements.")
+{
+    using namespace Chorasmia;
+    using Elements = ArrayView2DElements<int32_t>;
+    static_assert(std::random_access_iterator<Elements::Iterator>);
+    static_assert(std::ranges::random_access_range<Elements>);
+    static_assert(std::ranges::sized_range<Elements>);
+    static_assert(std::ranges::borrowed_range<Elements>);
+    static_assert(std::ranges::view<Elements>);
+    static_assert(std::ranges::contiguous_range<ArrayView<int32_t>>);
+    static_assert(std::ranges::view<ArrayView<int32_t>>);
+
+    std::vector<int32_t> a(20);
+    std::iota(a.begin(), a.end(), 0);
+    ArrayView2D grid(a.data(), {4, 5});
+    auto sub = grid.subarray({{1, 1}, {3, 3}});
+    auto elements = sub.elements();
+    REQUIRE(elements.size() == 9);
+    REQUIRE(std::vector<int32_t>(elements.begin(), elements.end())
+            == std::vector<int32_t>{6, 7, 8, 11, 12, 13, 16, 17, 18});
+
+    auto it = elements.begin();
+    REQUIRE(it[4] == 12);
+    REQUIRE(*(it + 8) == 18);
+    REQUIRE(*(elements.end() - 1) == 18);
+    REQUIRE(*(elements.end() - 4) == 13);
+    REQUIRE(elements.end() - it == 9);
+    REQUIRE((it + 7) - (it + 2) == 5);
+    REQUIRE((it + 2) - (it + 7) == -5);
+    auto it2 = it + 5;
+    it2 -= 3;
+    REQUIRE(*it2 == 8);
+    --it2;
+    --it2;
+    REQUIRE(*it2 == 6);
+    REQUIRE(it < it + 1);
+
+    REQUIRE(std::ranges::max(elements) == 18);
+    REQUIRE(*std::ranges::lower_bound(elements, 12) == 12);
+    REQUIRE(std::ranges::count_if(elements, [](auto v) {return v % 2 == 0;}) == 5);
+}
+
+TEST_CASE("ArrayView2D visit_elements.")
+{
+    using namespace Chorasmia;
+    std::vector<int32_t> a(12, 1);
+    ArrayView2D grid(a.data(), {3, 4});
+    auto sum = [](auto range)
+    {
+        return std::accumulate(range.begin(), range.end(), 0);
+    };
+    REQUIRE(visit_elements(grid, sum) == 12);
+    REQUIRE(visit_elements(grid.subarray({{0, 1}, {3, 2}}), sum) == 6);
+}
+
+TEST_CASE("ArrayView2D subarray of subarray.")
+{
+    using namespace Chorasmia;
+    std::vector<int32_t> a(20);
+    std::iota(a.begin(), a.end(), 0);
+    ArrayView2D grid(a.data(), {4, 5});
+    auto sub = grid.subarray({{1, 1}, {3, 4}}).subarray({{1, 1}, {2, 2}});
+    REQUIRE(sub.row_gap() == 3);
+    REQUIRE(sub[{0, 0}] == 12);
+    REQUIRE(sub[{1, 1}] == 18);
+}
@@ -28,6 +28,73 @@ TEST_CASE("Test copy")
     REQUIRE(b[{2, 1}] == 1);
 }
 
+TEST_CASE("Test transform")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({1, 2, 3, 4, 5, 6}, {2, 3});
+    Array2D<double> b({2, 3});
+    transform(a.view(), b.mut(), [](int v) {return v * 0.5;});
+    REQUIRE(b == Array2D<double>({0.5, 1, 1.5, 2, 2.5, 3}, {2, 3}));
+
+    Array2D<int> c({3, 4});
+    transform(a.view(), c.subarray({{1, 1}, {2, 3}}), [](int v) {return -v;});
+    REQUIRE(c == Array2D<int>({
+                                  0, 0, 0, 0,
+                                  0, -1, -2, -3,
+                                  0, -4, -5, -6
+                              }, {3, 4}));
+
+    Array2D<int> d({2, 2});
+    REQUIRE_THROWS_AS(transform(a.view(), d.mut(), [](int v) {return v;}),
+                      ChorasmiaException);
+}
+
+TEST_CASE("Test transform with two inputs")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({
+                       1, 2, 3,
+                       4, 5, 6,
+                       7, 8, 9
+                   }, {3, 3});
+    Array2D<int> b({10, 20, 30, 40}, {2, 2});
+    Array2D<int> c({2, 2});
+    transform(a.view().subarray({{1, 1}, {2, 2}}), b.view(), c.mut(),
+              [](int x, int y) {return x + y;});
+    REQUIRE(c == Array2D<int>({15, 26, 38, 49}, {2, 2}));
+    REQUIRE_THROWS_AS(transform(a.view(), b.view(), c.mut(),
+                                [](int x, int y) {return x + y;}),
+                      ChorasmiaException);
+}
+
+TEST_CASE("Test parallel transform")
+{
+    using namespace Chorasmia;
+    Array2D<float> a({300, 400});
+    Array2D<float> b({300, 400});
+    for (size_t i = 0; i < a.row_count(); ++i)
+    {
+        for (size_t j = 0; j < a.col_count(); ++j)
+        {
+            a[{i, j}] = float(i);
+            b[{i, j}] = float(j);
+        }
+    }
+
+    Array2D<float> c({300, 400});
+    transform(ParallelPolicy{4}, a.view(), b.view(), c.mut(),
+              [](float x, float y) {return x * 1000 + y;});
+    REQUIRE(c[{0, 0}] == 0);
+    REQUIRE(c[{299, 399}] == 299399);
+    REQUIRE(c[{150, 7}] == 150007);
+
+    Array2D<float> d({200, 300});
+    transform(ParallelPolicy{4}, c.view().subarray({{100, 100}, {200, 300}}),
+              d.mut(), [](float x) {return x + 1;});
+    REQUIRE(d[{0, 0}] == 100101);
+    REQUIRE(d[{199, 299}] == 299400);
+}
+
 TEST_CASE("Test that interpolate_value supports non-primitive types")
 {
     using namespace Chorasmia;
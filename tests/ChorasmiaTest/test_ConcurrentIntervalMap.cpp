@@ -0,0 +1,107 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/ConcurrentIntervalMap.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("ConcurrentIntervalMap snapshots")
+{
+    Chorasmia::ConcurrentIntervalMap<int, char, 4> map('x');
+    REQUIRE(map.version() == 0);
+    const auto old_snapshot = map.snapshot();
+
+    map.insert(0, 10, 'a');
+    map.insert(5, 'b');
+    REQUIRE(map.version() == 2);
+    REQUIRE(map.snapshot()->find(3)->second == 'a');
+    REQUIRE(map.snapshot()->find(7)->second == 'b');
+    REQUIRE(map.snapshot()->find(10)->second == 'x');
+    REQUIRE(old_snapshot->find(3)->second == 'x');
+    REQUIRE(old_snapshot->size() == 2);
+}
+
+TEST_CASE("ConcurrentIntervalMap update")
+{
+    Chorasmia::ConcurrentIntervalMap<int, int, 4> map;
+    auto reader = map.reader();
+    REQUIRE(reader.find(50) == 0);
+
+    map.update([](auto& m)
+    {
+        for (int i = 0; i < 100; ++i)
+            m.insert(i * 10, i * 10 + 5, i);
+    });
+    REQUIRE(map.version() == 1);
+    REQUIRE(reader.version() == 0);
+    REQUIRE(reader.find(51) == 5);
+    REQUIRE(reader.find(56) == 0);
+    REQUIRE(reader.version() == 1);
+
+    REQUIRE_THROWS(map.update([](auto& m)
+    {
+        m.insert(0, 1000, -1);
+        throw std::runtime_error("Failed");
+    }));
+    REQUIRE(map.version() == 1);
+    REQUIRE(reader.find(51) == 5);
+}
+
+TEST_CASE("ConcurrentIntervalMap with concurrent readers")
+{
+    // Every update assigns the same value to two intervals at opposite
+    // ends of the map. The readers check that they never see one of
+    // them updated without the other.
+    Chorasmia::ConcurrentIntervalMap<int, int, 8> map;
+    for (int i = 1; i < 999; ++i)
+        map.insert(i * 10, i * 10 + 5, -i);
+
+    constexpr int UPDATES = 2000;
+    const auto initial_version = map.version();
+    std::atomic<bool> done = false;
+    std::atomic<int> errors = 0;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t)
+    {
+        readers.emplace_back([&]
+        {
+            auto reader = map.reader();
+            int previous = 0;
+            while (!done.load())
+            {
+                const auto& snapshot = reader.get();
+                const auto first = snapshot.find(2)->second;
+                const auto last = snapshot.find(9992)->second;
+                if (first != last || first < previous)
+                    ++errors;
+                previous = first;
+            }
+        });
+    }
+
+    for (int i = 1; i <= UPDATES; ++i)
+    {
+        map.update([&](auto& m)
+        {
+            m.insert(0, 5, i);
+            m.insert(9990, 9995, i);
+            // Touch some leaves in the middle as well.
+            m.insert((i % 900) * 10 + 1, i);
+        });
+    }
+    done = true;
+    for (auto& thread : readers)
+        thread.join();
+
+    REQUIRE(errors == 0);
+    REQUIRE(map.version() == initial_version + UPDATES);
+    auto reader = map.reader();
+    REQUIRE(reader.find(2) == UPDATES);
+    REQUIRE(reader.find(9992) == UPDATES);
+}
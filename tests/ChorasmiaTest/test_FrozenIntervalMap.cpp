@@ -0,0 +1,107 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/FrozenIntervalMap.hpp>
+#include <Chorasmia/SegmentedIntervalMap.hpp>
+#include <random>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("FrozenIntervalMap basics")
+{
+    Chorasmia::IntervalMap<int, char> map('x');
+    map.insert(0, 10, 'a');
+    map.insert(20, 30, 'b');
+    map.insert(25, 'c');
+
+    Chorasmia::FrozenIntervalMap frozen(map);
+    REQUIRE(frozen.size() == map.size());
+    REQUIRE(frozen.find(-100) == 'x');
+    REQUIRE(frozen.find(0) == 'a');
+    REQUIRE(frozen.find(9) == 'a');
+    REQUIRE(frozen.find(10) == 'x');
+    REQUIRE(frozen.find(24) == 'b');
+    REQUIRE(frozen.find(25) == 'c');
+    REQUIRE(frozen.find(30) == 'x');
+    REQUIRE(frozen.find_boundary(27) == 25);
+    REQUIRE(frozen.find(std::numeric_limits<int>::max()) == char());
+}
+
+TEST_CASE("FrozenIntervalMap with keys below the lowest boundary")
+{
+    constexpr auto INF = std::numeric_limits<double>::infinity();
+    Chorasmia::IntervalMap<double, int> map(7);
+    for (int i = 0; i < 10; ++i)
+        map.insert(i, i + 0.5, i);
+
+    Chorasmia::FrozenIntervalMap frozen(map);
+    REQUIRE(frozen.find(-INF) == 7);
+    REQUIRE(frozen.find(-INF) == map.find(-INF)->second);
+    REQUIRE(frozen.find_boundary(-INF) == map.find(-INF)->first);
+    REQUIRE(frozen.find_boundary(-INF) == std::numeric_limits<double>::lowest());
+
+    Chorasmia::FrozenIntervalMap single(Chorasmia::IntervalMap<float, char>('a'));
+    REQUIRE(single.find(-std::numeric_limits<float>::infinity()) == 'a');
+}
+
+TEST_CASE("FrozenIntervalMap with bool values")
+{
+    Chorasmia::IntervalMap<float, bool> map(false);
+    map.insert(1, 2, true);
+    Chorasmia::FrozenIntervalMap frozen(map);
+    REQUIRE(!frozen.find(0.5f));
+    REQUIRE(frozen.find(1.5f));
+    const bool& value = frozen.find(1);
+    REQUIRE(value);
+    REQUIRE(!frozen.find(2));
+}
+
+TEST_CASE("FrozenIntervalMap with only the default value")
+{
+    Chorasmia::IntervalMap<double, int> map(7);
+    Chorasmia::FrozenIntervalMap frozen(map);
+    REQUIRE(frozen.size() == 2);
+    REQUIRE(frozen.find(0) == 7);
+    REQUIRE(frozen.find(-1e300) == 7);
+}
+
+TEST_CASE("FrozenIntervalMap matches IntervalMap::find")
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> dist(-1000, 1000);
+    Chorasmia::IntervalMap<double, int> map(-1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto from = dist(rng);
+        map.insert(from, from + dist(rng) / 50, i);
+    }
+
+    Chorasmia::FrozenIntervalMap frozen(map);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto key = dist(rng);
+        REQUIRE(frozen.find(key) == map.find(key)->second);
+        REQUIRE(frozen.find_boundary(key) == map.find(key)->first);
+    }
+
+    // Keys at, and within the margin of, the boundaries.
+    for (const auto& [key, value] : map)
+    {
+        REQUIRE(frozen.find(key) == value);
+        REQUIRE(frozen.find(key - 1e-15) == map.find(key - 1e-15)->second);
+    }
+}
+
+TEST_CASE("FrozenIntervalMap from SegmentedIntervalMap")
+{
+    Chorasmia::SegmentedIntervalMap<int, int, 4> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i * 3, i * 3 + 2, i);
+    Chorasmia::FrozenIntervalMap frozen(map);
+    REQUIRE(frozen.size() == map.size());
+    for (int key = -5; key < 310; ++key)
+        REQUIRE(frozen.find(key) == map.find(key)->second);
+}
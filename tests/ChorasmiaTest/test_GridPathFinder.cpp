@@ -0,0 +1,151 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/GridPathFinder.hpp>
+#include <Chorasmia/Array2D.hpp>
+#include <random>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using Catch::Matchers::WithinAbs;
+
+namespace
+{
+    using namespace Chorasmia;
+
+    Array2D<float> make_grid(size_t rows, size_t cols, double obstacles,
+                             bool uniform, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(0, 1);
+        Array2D<float> grid({rows, cols});
+        for (size_t i = 0; i < rows; ++i)
+        {
+            for (size_t j = 0; j < cols; ++j)
+            {
+                if (dist(rng) < obstacles)
+                    grid[{i, j}] = -1;
+                else
+                    grid[{i, j}] = uniform ? 1 : 1 + 4 * dist(rng);
+            }
+        }
+        grid[{0, 0}] = 1;
+        grid[{rows - 1, cols - 1}] = 1;
+        return grid;
+    }
+
+    bool is_valid_path(const Array2D<float>& grid,
+                       const std::vector<Index2D<uint32_t>>& path)
+    {
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (grid[{path[i].row, path[i].column}] < 0)
+                return false;
+            if (i == 0)
+                continue;
+            const auto dr = int(path[i].row) - int(path[i - 1].row);
+            const auto dc = int(path[i].column) - int(path[i - 1].column);
+            if (std::abs(dr) > 1 || std::abs(dc) > 1 || (dr == 0 && dc == 0))
+                return false;
+            if (dr != 0 && dc != 0
+                && (grid[{path[i - 1].row, path[i].column}] < 0
+                    || grid[{path[i].row, path[i - 1].column}] < 0))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("GridPathFinder on a simple grid")
+{
+    using namespace Chorasmia;
+    Array2D<float> grid({
+                            1, 1, 1, 1,
+                            1, -1, -1, 1,
+                            1, 1, -1, 1,
+                            1, 1, 1, 1
+                        }, {4, 4});
+    std::vector<Index2D<uint32_t>> path;
+
+    GridPathFinder finder;
+    REQUIRE(finder.find_path(grid.view(), {2, 1}, {1, 3}, path));
+    REQUIRE(path.front() == Index2D<uint32_t>(2, 1));
+    REQUIRE(path.back() == Index2D<uint32_t>(1, 3));
+    REQUIRE(is_valid_path(grid, path));
+    REQUIRE(finder.path_cost() == 5);
+    REQUIRE(finder.find_path(grid.view(), {3, 0}, {2, 1}, path));
+    REQUIRE(path.size() == 2);
+    REQUIRE_THAT(finder.path_cost(), WithinAbs(1.41421356, 1e-4));
+
+    GridPathFinder four({PathAlgorithm::A_STAR, GridNeighborhood::FOUR});
+    REQUIRE(four.find_path(grid.view(), {2, 1}, {1, 3}, path));
+    REQUIRE(path.size() == 6);
+    REQUIRE(four.path_cost() == 5);
+    REQUIRE(four.find_path(grid.view(), {3, 0}, {2, 1}, path));
+    REQUIRE(four.path_cost() == 2);
+}
+
+TEST_CASE("GridPathFinder without a path")
+{
+    using namespace Chorasmia;
+    Array2D<float> grid({
+                            1, -1, 1,
+                            1, -1, 1,
+                            1, -1, 1
+                        }, {3, 3});
+    std::vector<Index2D<uint32_t>> path;
+    GridPathFinder finder;
+    REQUIRE_FALSE(finder.find_path(grid.view(), {0, 0}, {2, 2}, path));
+    REQUIRE(path.empty());
+    REQUIRE_FALSE(finder.find_path(grid.view(), {0, 1}, {2, 2}, path));
+    REQUIRE_THROWS_AS(finder.find_path(grid.view(), {0, 0}, {3, 2}, path),
+                      ChorasmiaException);
+    REQUIRE_THROWS_AS(GridPathFinder({PathAlgorithm::JUMP_POINT_SEARCH,
+                                      GridNeighborhood::FOUR}),
+                      ChorasmiaException);
+}
+
+TEST_CASE("A* and Dijkstra agree on weighted grids")
+{
+    using namespace Chorasmia;
+    GridPathFinder a_star({PathAlgorithm::A_STAR});
+    GridPathFinder dijkstra({PathAlgorithm::DIJKSTRA});
+    std::vector<Index2D<uint32_t>> path1, path2;
+    for (unsigned seed = 0; seed < 10; ++seed)
+    {
+        auto grid = make_grid(40, 50, 0.25, false, seed);
+        const auto found = a_star.find_path(grid.view(), {0, 0}, {39, 49}, path1);
+        REQUIRE(found == dijkstra.find_path(grid.view(), {0, 0}, {39, 49}, path2));
+        if (!found)
+            continue;
+        REQUIRE(is_valid_path(grid, path1));
+        REQUIRE(is_valid_path(grid, path2));
+        REQUIRE_THAT(a_star.path_cost(), WithinAbs(dijkstra.path_cost(), 1e-3));
+    }
+}
+
+TEST_CASE("Jump Point Search agrees with A* on uniform grids")
+{
+    using namespace Chorasmia;
+    GridPathFinder a_star({PathAlgorithm::A_STAR});
+    GridPathFinder jps({PathAlgorithm::JUMP_POINT_SEARCH});
+    std::vector<Index2D<uint32_t>> path1, path2;
+    for (unsigned seed = 0; seed < 20; ++seed)
+    {
+        auto grid = make_grid(60, 45, 0.3, true, seed);
+        const auto found = a_star.find_path(grid.view(), {0, 0}, {59, 44}, path1);
+        REQUIRE(found == jps.find_path(grid.view(), {0, 0}, {59, 44}, path2));
+        if (!found)
+            continue;
+        REQUIRE(is_valid_path(grid, path2));
+        REQUIRE(path2.front() == Index2D<uint32_t>(0, 0));
+        REQUIRE(path2.back() == Index2D<uint32_t>(59, 44));
+        REQUIRE_THAT(jps.path_cost(), WithinAbs(a_star.path_cost(), 1e-3));
+    }
+}
@@ -0,0 +1,91 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/GridRay.hpp>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    using Chorasmia::Index2D;
+
+    std::vector<Index2D<size_t>> get_cells(const Chorasmia::GridRay& ray)
+    {
+        std::vector<Index2D<size_t>> result;
+        for (auto cell : ray)
+            result.push_back(cell);
+        return result;
+    }
+}
+
+TEST_CASE("GridRay along a row")
+{
+    using namespace Chorasmia;
+    GridRay ray({1.5, 0.5}, {1.5, 3.5}, {3, 5});
+    REQUIRE(ray.size() == 4);
+    std::vector<Index2D<size_t>> expected = {{1, 0}, {1, 1}, {1, 2}, {1, 3}};
+    REQUIRE(get_cells(ray) == expected);
+}
+
+TEST_CASE("GridRay backwards along a column")
+{
+    using namespace Chorasmia;
+    GridRay ray({3.0, 0.5}, {1.0, 0.5}, {5, 5});
+    std::vector<Index2D<size_t>> expected = {{2, 0}, {1, 0}};
+    REQUIRE(get_cells(ray) == expected);
+}
+
+TEST_CASE("GridRay diagonal")
+{
+    using namespace Chorasmia;
+    GridRay ray({0.2, 0.5}, {2.2, 3.5}, {4, 4});
+    std::vector<Index2D<size_t>> expected = {
+        {0, 0}, {0, 1}, {1, 1}, {1, 2}, {1, 3}, {2, 3}
+    };
+    REQUIRE(get_cells(ray) == expected);
+
+    auto it = ray.begin();
+    REQUIRE(it.t_entry() == 0);
+    REQUIRE(it.t_exit() == 1.0 / 6);
+    ++it;
+    REQUIRE(it.t_entry() == 1.0 / 6);
+    REQUIRE(it.t_exit() == 0.4);
+}
+
+TEST_CASE("GridRay is clipped to the array")
+{
+    using namespace Chorasmia;
+    GridRay ray({-1.5, 1.5}, {10.5, 1.5}, {3, 3});
+    std::vector<Index2D<size_t>> expected = {{0, 1}, {1, 1}, {2, 1}};
+    REQUIRE(get_cells(ray) == expected);
+    REQUIRE(ray.begin().t_entry() == 0.125);
+
+    REQUIRE(GridRay({-1, -1}, {-1, 5}, {3, 3}).empty());
+    REQUIRE(GridRay({0.5, 0.5}, {0.5, 0.5}, {0, 3}).empty());
+}
+
+TEST_CASE("GridRay cells are edge-connected and end at the last cell")
+{
+    using namespace Chorasmia;
+    const Point2D<double> from{32.3, 30.1};
+    for (int k = 0; k < 32; ++k)
+    {
+        const auto angle = k * 0.19634954084936207;
+        const Point2D<double> to{from.row + 20 * std::sin(angle),
+                                 from.column + 20 * std::cos(angle)};
+        auto cells = get_cells(GridRay(from, to, {64, 64}));
+        REQUIRE(cells.front() == Index2D<size_t>(32, 30));
+        for (size_t i = 1; i < cells.size(); ++i)
+        {
+            const auto dr = std::abs(ptrdiff_t(cells[i].row) - ptrdiff_t(cells[i - 1].row));
+            const auto dc = std::abs(ptrdiff_t(cells[i].column) - ptrdiff_t(cells[i - 1].column));
+            REQUIRE(dr + dc == 1);
+        }
+        REQUIRE(cells.back() == Index2D<size_t>(size_t(std::floor(to.row)),
+                                                size_t(std::floor(to.column))));
+    }
+}
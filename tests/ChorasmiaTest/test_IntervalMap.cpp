@@ -7,7 +7,11 @@
 //****************************************************************************
 #include <Chorasmia/IntervalMap.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <cfloat>
+#include <random>
+#include <tuple>
+#include <vector>
 
 TEST_CASE("Test IntervalMap point insert")
 {
@@ -116,3 +120,133 @@ TEST_CASE("Test IntervalMap range insert")
         REQUIRE(map.data()[4] == P{2, 3});
     }
 }
+
+TEST_CASE("Test IntervalMap assign")
+{
+    using P = std::pair<int, int>;
+    Chorasmia::IntervalMap<int, int> map(-1);
+    map.insert(5, 100);
+    std::vector<std::tuple<int, int, int>> intervals{
+        {0, 10, 1}, {5, 15, 2}, {20, 30, 3}, {22, 25, 4}, {12, 8, 5}, {40, 40, 6}};
+    map.assign(intervals);
+    REQUIRE(map.size() == 11);
+    REQUIRE(map.data()[1] == P{0, 1});
+    REQUIRE(map.data()[2] == P{5, 2});
+    REQUIRE(map.data()[3] == P{8, 5});
+    REQUIRE(map.data()[4] == P{12, 2});
+    REQUIRE(map.data()[5] == P{15, -1});
+    REQUIRE(map.data()[6] == P{20, 3});
+    REQUIRE(map.data()[7] == P{22, 4});
+    REQUIRE(map.data()[8] == P{25, 3});
+    REQUIRE(map.data()[9] == P{30, -1});
+    REQUIRE(map.find(35)->second == -1);
+
+    map.assign(std::vector<std::tuple<int, int, int>>());
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.find(0)->second == -1);
+}
+
+TEST_CASE("Test IntervalMap assign is the same as sequential inserts")
+{
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> dist(-500, 500);
+    std::vector<std::tuple<int, int, int>> intervals;
+    Chorasmia::IntervalMap<int, int> expected;
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto from = dist(rng);
+        const auto to = from + dist(rng) / 8;
+        const auto value = dist(rng) % 4;
+        intervals.emplace_back(from, to, value);
+        expected.insert(from, to, value);
+    }
+
+    Chorasmia::IntervalMap<int, int> map;
+    map.assign(intervals);
+    REQUIRE(std::vector<std::pair<int, int>>(map.begin(), map.end())
+            == std::vector<std::pair<int, int>>(expected.begin(), expected.end()));
+}
+
+TEST_CASE("Test IntervalMap assign with floating point keys")
+{
+    struct Interval
+    {
+        double from;
+        double to;
+        char value;
+    };
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    std::vector<Interval> intervals;
+    Chorasmia::IntervalMap<double, char> expected;
+    for (int i = 0; i < 500; ++i)
+    {
+        const auto from = dist(rng);
+        intervals.push_back({from, from + dist(rng) / 10, char('a' + i % 26)});
+        expected.insert(intervals.back().from, intervals.back().to,
+                        intervals.back().value);
+    }
+
+    Chorasmia::IntervalMap<double, char> map;
+    map.assign(intervals);
+    REQUIRE(map.size() == expected.size());
+    REQUIRE(std::equal(map.begin(), map.end(), expected.begin()));
+}
+
+TEST_CASE("Test IntervalMap find_many")
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> dist(-100, 100);
+    Chorasmia::IntervalMap<double, int> map(-1);
+    for (int i = 0; i < 300; ++i)
+    {
+        const auto from = dist(rng);
+        map.insert(from, from + dist(rng) / 20, i);
+    }
+
+    std::vector<double> keys(1001);
+    for (auto& key : keys)
+        key = dist(rng);
+    // Include the boundaries themselves.
+    for (size_t i = 0; i < map.size() && i < keys.size(); i += 3)
+        keys[i] = map.data()[i].first;
+
+    using Iterator = Chorasmia::IntervalMap<double, int>::Iterator;
+
+    SECTION("Unsorted keys")
+    {
+        std::vector<Iterator> iterators(keys.size());
+        map.find_many(keys, iterators);
+        std::vector<int> values(keys.size());
+        map.find_many(keys, values);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            REQUIRE(iterators[i] == map.find(keys[i]));
+            REQUIRE(values[i] == map.find(keys[i])->second);
+        }
+    }
+
+    SECTION("Sorted keys")
+    {
+        std::sort(keys.begin(), keys.end());
+        std::vector<Iterator> iterators(keys.size());
+        map.find_many(keys, iterators);
+        for (size_t i = 0; i < keys.size(); ++i)
+            REQUIRE(iterators[i] == map.find(keys[i]));
+    }
+
+    SECTION("Parallel")
+    {
+        std::vector<int> values(keys.size());
+        map.find_many(Chorasmia::ParallelPolicy{4}, keys, values);
+        for (size_t i = 0; i < keys.size(); ++i)
+            REQUIRE(values[i] == map.find(keys[i])->second);
+    }
+
+    SECTION("Too few results")
+    {
+        std::vector<int> values(keys.size() - 1);
+        REQUIRE_THROWS(map.find_many(keys, values));
+    }
+}
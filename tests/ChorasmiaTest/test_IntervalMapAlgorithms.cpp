@@ -0,0 +1,105 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/IntervalMapAlgorithms.hpp>
+#include <Chorasmia/Array2D.hpp>
+#include <cstdint>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Test classify with 8-bit keys")
+{
+    using namespace Chorasmia;
+    IntervalMap<uint8_t, char> map('-');
+    map.insert(10, 20, 'a');
+    map.insert(200, 'b');
+
+    Array2D<uint8_t> src({0, 10, 19, 20, 199, 200, 255, 15}, {2, 4});
+    Array2D<char> dst({2, 4});
+    classify(src.view(), map, dst.mut());
+    // Like find, the largest key gets the value of the end boundary.
+    REQUIRE(dst == Array2D<char>({'-', 'a', 'a', '-', '-', 'b', '\0', 'a'}, {2, 4}));
+
+    Array2D<char> small({2, 2});
+    REQUIRE_THROWS(classify(src.view(), map, small.mut()));
+}
+
+TEST_CASE("Test classify with 16-bit signed keys and a subarray")
+{
+    using namespace Chorasmia;
+    IntervalMap<int16_t, int> map(0);
+    map.insert(-32768, -100, 1);
+    map.insert(100, 32767, 2);
+
+    Array2D<int16_t> src({-32768, -101, -100, 0,
+                          99, 100, 32766, 32767,
+                          5, 5, 5, 5}, {3, 4});
+    Array2D<int> dst({4, 4});
+    classify(src.view().subarray({{0, 0}, {2, 4}}), map,
+             dst.subarray({{1, 0}, {2, 4}}));
+    REQUIRE(dst == Array2D<int>({0, 0, 0, 0,
+                                 1, 1, 0, 0,
+                                 0, 2, 2, map.find(32767)->second,
+                                 0, 0, 0, 0}, {4, 4}));
+}
+
+TEST_CASE("Test classify with floating point keys")
+{
+    using namespace Chorasmia;
+    IntervalMap<float, uint8_t> map(0);
+    for (int i = 0; i < 10; ++i)
+        map.insert(float(i) * 10, float(i) * 10 + 5, uint8_t(i + 1));
+
+    Array2D<float> src({300, 200});
+    for (size_t i = 0; i < src.row_count(); ++i)
+    {
+        for (size_t j = 0; j < src.col_count(); ++j)
+            src[{i, j}] = float(i) * 0.3f + float(j) * 0.05f - 5;
+    }
+
+    Array2D<uint8_t> expected({300, 200});
+    transform(src.view(), expected.mut(), [&](float v)
+    {
+        return map.find(v)->second;
+    });
+
+    Array2D<uint8_t> dst({300, 200});
+    classify(src.view(), map, dst.mut());
+    REQUIRE(dst == expected);
+
+    Array2D<uint8_t> parallel_dst({300, 200});
+    classify(ParallelPolicy{4}, src.view(), map, parallel_dst.mut());
+    REQUIRE(parallel_dst == expected);
+}
+
+TEST_CASE("Test classify to a bool mask")
+{
+    using namespace Chorasmia;
+    IntervalMap<uint8_t, bool> map(false);
+    map.insert(100, 200, true);
+
+    Array2D<uint8_t> src({0, 99, 100, 150, 199, 200}, {2, 3});
+    // Array2D<bool> would use std::vector<bool>, so the mask is a
+    // view of a plain array.
+    bool mask[6] = {};
+    classify(src.view(), map, MutableArrayView2D<bool>(mask, {2, 3}));
+    REQUIRE(!mask[0]);
+    REQUIRE(!mask[1]);
+    REQUIRE(mask[2]);
+    REQUIRE(mask[3]);
+    REQUIRE(mask[4]);
+    REQUIRE(!mask[5]);
+
+    IntervalMap<float, bool> float_map(false);
+    float_map.insert(1, 2, true);
+    Array2D<float> float_src({0.5f, 1, 1.5f, 2}, {2, 2});
+    bool float_mask[4] = {};
+    classify(float_src.view(), float_map, MutableArrayView2D<bool>(float_mask, {2, 2}));
+    REQUIRE(!float_mask[0]);
+    REQUIRE(float_mask[1]);
+    REQUIRE(float_mask[2]);
+    REQUIRE(!float_mask[3]);
+}
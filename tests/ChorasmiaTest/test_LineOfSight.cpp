@@ -0,0 +1,91 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/LineOfSight.hpp>
+#include <Chorasmia/Array2D.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Test has_line_of_sight")
+{
+    using namespace Chorasmia;
+    Array2D<float> heights({
+                               0, 0, 0, 0, 0,
+                               0, 0, 5, 0, 0,
+                               0, 0, 0, 0, 0
+                           }, {3, 5});
+    REQUIRE(has_line_of_sight(heights.view(), {0, 0}, {0, 4}));
+    REQUIRE_FALSE(has_line_of_sight(heights.view(), {1, 0}, {1, 4}));
+    REQUIRE(has_line_of_sight(heights.view(), {1, 0}, {1, 4}, 6, 6));
+    REQUIRE_FALSE(has_line_of_sight(heights.view(), {1, 0}, {1, 4}, 6, 0));
+    REQUIRE(has_line_of_sight(heights.view(), {1, 0}, {1, 1}));
+    REQUIRE(has_line_of_sight(heights.view(), {1, 2}, {1, 2}));
+    REQUIRE_THROWS_AS(has_line_of_sight(heights.view(), {1, 0}, {3, 0}),
+                      ChorasmiaException);
+}
+
+TEST_CASE("Test check_lines_of_sight")
+{
+    using namespace Chorasmia;
+    Array2D<int> heights({
+                             0, 0, 0, 0,
+                             0, 9, 9, 0,
+                             0, 0, 0, 0
+                         }, {3, 4});
+    std::vector<SightLine> lines = {
+        {{0, 0}, {0, 3}},
+        {{1, 0}, {1, 3}},
+        {{2, 0}, {0, 3}},
+        {{0, 0}, {2, 0}}
+    };
+    bool results[4] = {};
+    check_lines_of_sight<int>(heights.view(), lines, results, 1, 0, 2);
+    REQUIRE(results[0]);
+    REQUIRE_FALSE(results[1]);
+    REQUIRE_FALSE(results[2]);
+    REQUIRE(results[3]);
+}
+
+TEST_CASE("Test compute_viewshed")
+{
+    using namespace Chorasmia;
+    Array2D<double> heights({
+                                0, 0, 0, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0,
+                                0, 0, 3, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0,
+                                0, 0, 0, 0, 0, 0
+                            }, {5, 6});
+    Array2D<uint8_t> visible({5, 6});
+    compute_viewshed(heights.view(), {2, 0}, 1, visible.mut(), 0, 3);
+
+    Array2D<uint8_t> expected({
+                                  1, 1, 1, 1, 1, 1,
+                                  1, 1, 1, 1, 1, 0,
+                                  1, 1, 1, 0, 0, 0,
+                                  1, 1, 1, 1, 1, 0,
+                                  1, 1, 1, 1, 1, 1
+                              }, {5, 6});
+    REQUIRE(visible == expected);
+
+    Array2D<uint8_t> wrong_size({5, 5});
+    REQUIRE_THROWS_AS(compute_viewshed(heights.view(), {2, 0}, 1, wrong_size.mut()),
+                      ChorasmiaException);
+}
+
+TEST_CASE("compute_viewshed agrees with has_line_of_sight on flat terrain")
+{
+    using namespace Chorasmia;
+    Array2D<float> heights({20, 30});
+    heights.fill(2);
+    Array2D<uint8_t> visible({20, 30});
+    compute_viewshed(heights.view(), {4, 17}, 0.5, visible.mut());
+    for (auto row : visible)
+    {
+        for (auto v : row)
+            REQUIRE(v == 1);
+    }
+}
@@ -0,0 +1,176 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/MdspanInterop.hpp>
+#include <Chorasmia/Array2D.hpp>
+#include <array>
+#include <numeric>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    // Mimics the parts of std::mdspan used by MdspanInterop.hpp, so the
+    // tests also run on standard libraries without <mdspan>.
+    struct FakeExtents
+    {
+        FakeExtents(size_t rows, size_t cols) : values{rows, cols} {}
+
+        std::array<size_t, 2> values;
+    };
+
+    struct FakeStrideMapping
+    {
+        FakeStrideMapping(FakeExtents extents, std::array<size_t, 2> strides)
+            : extents(extents), strides(strides)
+        {}
+
+        FakeExtents extents;
+        std::array<size_t, 2> strides;
+    };
+
+    template <typename T>
+    struct FakeMdspan
+    {
+        using element_type = T;
+        using extents_type = FakeExtents;
+        using mapping_type = FakeStrideMapping;
+
+        FakeMdspan(T* data, std::array<size_t, 2> extents,
+                   std::array<size_t, 2> strides)
+            : data(data), extents(extents), strides(strides)
+        {}
+
+        FakeMdspan(T* data, const mapping_type& mapping)
+            : data(data),
+              extents(mapping.extents.values),
+              strides(mapping.strides)
+        {}
+
+        static constexpr size_t rank() noexcept
+        {
+            return 2;
+        }
+
+        size_t extent(size_t r) const noexcept
+        {
+            return extents[r];
+        }
+
+        size_t stride(size_t r) const noexcept
+        {
+            return strides[r];
+        }
+
+        T* data_handle() const noexcept
+        {
+            return data;
+        }
+
+        T* data;
+        std::array<size_t, 2> extents;
+        std::array<size_t, 2> strides;
+    };
+}
+
+TEST_CASE("ArrayView2D from mdspan")
+{
+    using namespace Chorasmia;
+    static_assert(Mdspan2D<FakeMdspan<int>>);
+    static_assert(!Mdspan2D<ArrayView2D<int>>);
+
+    std::vector<int> values(12);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto view = make_array_view_2d(FakeMdspan<int>{values.data(), {3, 4}, {4, 1}});
+    REQUIRE(view.dimensions() == Size2D<size_t>(3, 4));
+    REQUIRE(view.contiguous());
+    REQUIRE(view[{2, 1}] == 9);
+
+    auto strided = make_array_view_2d(FakeMdspan<const int>{values.data() + 1, {3, 2}, {4, 1}});
+    REQUIRE(strided.row_gap() == 2);
+    REQUIRE(strided[{1, 0}] == 5);
+    REQUIRE(strided[{2, 1}] == 10);
+
+    REQUIRE_THROWS_AS(make_array_view_2d(FakeMdspan<int>{values.data(), {3, 4}, {1, 3}}),
+                      ChorasmiaException);
+    REQUIRE_THROWS_AS(make_array_view_2d(FakeMdspan<int>{values.data(), {3, 4}, {2, 1}}),
+                      ChorasmiaException);
+}
+
+TEST_CASE("MutableArrayView2D from mdspan")
+{
+    using namespace Chorasmia;
+    std::vector<int> values(12);
+    auto view = make_mutable_array_view_2d(FakeMdspan<int>{values.data() + 5, {2, 2}, {4, 1}});
+    view[{1, 1}] = 7;
+    REQUIRE(values[10] == 7);
+}
+
+TEST_CASE("Array2D from mdspan")
+{
+    using namespace Chorasmia;
+    std::vector<int> values(6);
+    std::iota(values.begin(), values.end(), 1);
+
+    // A column-major (layout_left) 2x3 matrix.
+    Array2D<int> a(FakeMdspan<int>{values.data(), {2, 3}, {1, 2}});
+    REQUIRE(a == Array2D<int>({1, 3, 5, 2, 4, 6}, {2, 3}));
+}
+
+TEST_CASE("Array2D adopting the values in an mdspan")
+{
+    using namespace Chorasmia;
+    auto values = std::make_shared<std::vector<int>>(6);
+    std::iota(values->begin(), values->end(), 1);
+
+    Array2D<int> a(FakeMdspan<int>{values->data(), {2, 3}, {3, 1}}, values);
+    REQUIRE(a.has_external_buffer());
+    REQUIRE(a.data() == values->data());
+    REQUIRE(a == Array2D<int>({1, 2, 3, 4, 5, 6}, {2, 3}));
+
+    REQUIRE_THROWS_AS(Array2D<int>(FakeMdspan<int>{values->data(), {2, 3}, {1, 2}}, values),
+                      ChorasmiaException);
+    REQUIRE_THROWS_AS(Array2D<int>(FakeMdspan<int>{values->data(), {2, 2}, {3, 1}}, values),
+                      ChorasmiaException);
+}
+
+TEST_CASE("ArrayView2D to mdspan")
+{
+    using namespace Chorasmia;
+    static_assert(StridedMdspan2D<FakeMdspan<int>>);
+
+    std::vector<int> values(12);
+    std::iota(values.begin(), values.end(), 0);
+    ArrayView2D<int> grid(values.data(), {3, 4});
+    const auto sub = grid.subarray({{1, 1}, {2, 2}});
+
+    auto m = to_mdspan<FakeMdspan<const int>>(sub);
+    REQUIRE(m.data_handle() == values.data() + 5);
+    REQUIRE(m.extent(0) == 2);
+    REQUIRE(m.extent(1) == 2);
+    REQUIRE(m.stride(0) == 4);
+    REQUIRE(m.stride(1) == 1);
+
+    auto view = make_array_view_2d(m);
+    REQUIRE(view == sub);
+}
+
+TEST_CASE("MutableArrayView2D to mdspan")
+{
+    using namespace Chorasmia;
+    std::vector<int> values(12);
+    MutableArrayView2D<int> grid(values.data(), {3, 4});
+
+    auto m = to_mdspan<FakeMdspan<int>>(grid.subarray({{1, 2}, {2, 2}}));
+    REQUIRE(m.stride(0) == 4);
+    m.data_handle()[m.stride(0) + 1] = 7;
+    REQUIRE(values[11] == 7);
+
+    auto const_m = to_mdspan<FakeMdspan<const int>>(grid);
+    REQUIRE(const_m.extent(0) == 3);
+    REQUIRE(const_m.stride(0) == 4);
+}
@@ -0,0 +1,93 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/MirroredRingBuffer.hpp>
+
+#ifdef __linux__
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("MirroredRingBuffer capacity fills whole pages")
+{
+    Chorasmia::MirroredRingBuffer<int> buffer(10);
+    const auto page_size = size_t(sysconf(_SC_PAGESIZE));
+    REQUIRE(buffer.capacity() >= 10);
+    REQUIRE(buffer.capacity() * sizeof(int) % page_size == 0);
+    REQUIRE(buffer.empty());
+
+    Chorasmia::MirroredRingBuffer<int> none;
+    REQUIRE(none.capacity() == 0);
+    none.push_back(1);
+    REQUIRE(none.empty());
+}
+
+TEST_CASE("MirroredRingBuffer values are contiguous across the wrap point")
+{
+    Chorasmia::MirroredRingBuffer<uint32_t> buffer(1);
+    const auto cap = buffer.capacity();
+
+    std::vector<uint32_t> values(cap);
+    std::iota(values.begin(), values.end(), 0);
+    buffer.push_back(std::span<const uint32_t>(values));
+    REQUIRE(buffer.size() == cap);
+
+    // Move the start close to the end of the memory, then add values
+    // that wrap around.
+    buffer.pop_front(cap - 3);
+    std::vector<uint32_t> more{1000, 1001, 1002, 1003, 1004};
+    buffer.push_back(std::span<const uint32_t>(more));
+
+    auto span = buffer.read_span();
+    REQUIRE(span.size() == 8);
+    REQUIRE(std::vector<uint32_t>(span.begin(), span.end())
+            == std::vector<uint32_t>{uint32_t(cap - 3), uint32_t(cap - 2),
+                                     uint32_t(cap - 1), 1000, 1001, 1002, 1003, 1004});
+    REQUIRE(buffer.front() == cap - 3);
+    REQUIRE(buffer.back() == 1004);
+    REQUIRE(buffer[4] == 1001);
+}
+
+TEST_CASE("MirroredRingBuffer write_span and commit")
+{
+    Chorasmia::MirroredRingBuffer<char> buffer(1);
+    const auto cap = buffer.capacity();
+    buffer.commit(cap - 2);
+    buffer.pop_front(cap - 2);
+
+    auto out = buffer.write_span();
+    REQUIRE(out.size() == cap);
+    const std::string message = "hello, world";
+    std::copy(message.begin(), message.end(), out.begin());
+    buffer.commit(message.size());
+
+    auto in = buffer.read_span();
+    REQUIRE(std::string(in.begin(), in.end()) == message);
+    REQUIRE_THROWS(buffer.commit(cap));
+
+    buffer.pop_front(7);
+    REQUIRE(std::string(buffer.begin(), buffer.end()) == "world");
+}
+
+TEST_CASE("MirroredRingBuffer overwrites the oldest values")
+{
+    Chorasmia::MirroredRingBuffer<int> buffer(1);
+    const auto cap = buffer.capacity();
+    for (size_t i = 0; i < cap + 5; ++i)
+        buffer.push_back(int(i));
+    REQUIRE(buffer.size() == cap);
+    REQUIRE(buffer.front() == 5);
+    REQUIRE(buffer.back() == int(cap + 4));
+
+    auto moved = std::move(buffer);
+    REQUIRE(buffer.capacity() == 0);
+    REQUIRE(moved.front() == 5);
+}
+
+#endif
@@ -0,0 +1,179 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/MpmcRingBuffer.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("MpmcRingBuffer push and pop")
+{
+    Chorasmia::MpmcRingBuffer<int, 3> buffer;
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.try_push(1));
+    REQUIRE(buffer.try_push(2));
+    buffer.push(3);
+    REQUIRE_FALSE(buffer.try_push(4));
+    REQUIRE(buffer.size() == 3);
+
+    int value = 0;
+    REQUIRE(buffer.try_pop(value));
+    REQUIRE(value == 1);
+    REQUIRE(buffer.try_push(4));
+    REQUIRE(buffer.pop() == 2);
+    REQUIRE(buffer.pop() == 3);
+    REQUIRE(buffer.try_pop(value));
+    REQUIRE(value == 4);
+    REQUIRE_FALSE(buffer.try_pop(value));
+}
+
+TEST_CASE("MpmcRingBuffer try_push doesn't move from value when full")
+{
+    Chorasmia::MpmcRingBuffer<std::unique_ptr<int>, 2> buffer;
+    REQUIRE(buffer.try_push(std::make_unique<int>(1)));
+    REQUIRE(buffer.try_push(std::make_unique<int>(0)));
+    auto ptr = std::make_unique<int>(2);
+    REQUIRE_FALSE(buffer.try_push(std::move(ptr)));
+    REQUIRE(ptr);
+    REQUIRE(*buffer.pop() == 1);
+}
+
+namespace
+{
+    // Has no default constructor and counts the live instances.
+    struct Counted
+    {
+        explicit Counted(int value, int& live)
+            : value(value), live(&live)
+        {
+            ++live;
+        }
+
+        Counted(const Counted& other)
+            : value(other.value), live(other.live)
+        {
+            ++*live;
+        }
+
+        Counted& operator=(const Counted&) = default;
+
+        ~Counted()
+        {
+            --*live;
+        }
+
+        int value;
+        int* live;
+    };
+}
+
+TEST_CASE("MpmcRingBuffer destroys popped and remaining values")
+{
+    int live = 0;
+    {
+        Chorasmia::MpmcRingBuffer<Counted, 4> buffer;
+        buffer.push(Counted(1, live));
+        REQUIRE(buffer.try_push(Counted(2, live)));
+        buffer.push(Counted(3, live));
+        REQUIRE(live == 3);
+
+        REQUIRE(buffer.pop().value == 1);
+        REQUIRE(live == 2);
+        Counted value(0, live);
+        REQUIRE(buffer.try_pop(value));
+        REQUIRE(value.value == 2);
+        REQUIRE(live == 2);
+
+        // Wrap around so the remaining values aren't at the start.
+        buffer.push(Counted(4, live));
+        buffer.push(Counted(5, live));
+        buffer.push(Counted(6, live));
+        REQUIRE(live == 5);
+    }
+    REQUIRE(live == 0);
+}
+
+TEST_CASE("MpmcRingBuffer try_push and try_pop wake waiting threads")
+{
+    Chorasmia::MpmcRingBuffer<int, 2> buffer;
+    int popped = 0;
+    std::thread consumer([&] {popped = buffer.pop();});
+    // Give the consumer time to stop spinning and start waiting.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(buffer.try_push(7));
+    consumer.join();
+    REQUIRE(popped == 7);
+
+    REQUIRE(buffer.try_push(1));
+    REQUIRE(buffer.try_push(2));
+    std::thread producer([&] {buffer.push(3);});
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    int value = 0;
+    REQUIRE(buffer.try_pop(value));
+    producer.join();
+    REQUIRE(value == 1);
+    REQUIRE(buffer.pop() == 2);
+    REQUIRE(buffer.pop() == 3);
+}
+
+TEST_CASE("MpmcRingBuffer with many producers and consumers")
+{
+    constexpr size_t THREADS = 4;
+    constexpr size_t COUNT_PER_THREAD = 20'000;
+    Chorasmia::MpmcRingBuffer<size_t, 64> buffer;
+    std::vector<size_t> sums(THREADS);
+    std::vector<size_t> counts(THREADS);
+
+    {
+        std::vector<std::jthread> threads;
+        for (size_t t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&buffer, t]
+            {
+                for (size_t i = 0; i < COUNT_PER_THREAD; ++i)
+                {
+                    const auto value = t * COUNT_PER_THREAD + i + 1;
+                    if (t % 2 == 0)
+                        buffer.push(value);
+                    else while (!buffer.try_push(value))
+                        std::this_thread::yield();
+                }
+            });
+            threads.emplace_back([&buffer, &sum = sums[t], &count = counts[t], t]
+            {
+                for (size_t i = 0; i < COUNT_PER_THREAD; ++i)
+                {
+                    size_t value;
+                    if (t % 2 == 0)
+                    {
+                        value = buffer.pop();
+                    }
+                    else
+                    {
+                        while (!buffer.try_pop(value))
+                            std::this_thread::yield();
+                    }
+                    sum += value;
+                    ++count;
+                }
+            });
+        }
+    }
+
+    size_t total_sum = 0, total_count = 0;
+    for (size_t t = 0; t < THREADS; ++t)
+    {
+        total_sum += sums[t];
+        total_count += counts[t];
+    }
+    constexpr auto n = THREADS * COUNT_PER_THREAD;
+    REQUIRE(total_count == n);
+    REQUIRE(total_sum == n * (n + 1) / 2);
+    REQUIRE(buffer.empty());
+}
@@ -8,6 +8,8 @@
 #include "Chorasmia/MutableArrayView2D.hpp"
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <numeric>
 #include <vector>
 
@@ -48,3 +50,35 @@ TEST_CASE("MutableArrayView2D subarray iterator")
     REQUIRE(grid[{3, 2}] == 3);
     REQUIRE(grid[{3, 3}] == 4);
 }
+
+TEST_CASE("MutableArrayView2D elements")
+{
+    std::vector<int> values(16);
+    Chorasmia::MutableArrayView2D grid(values.data(), {4, 4});
+    auto elements = grid.subarray({{1, 1}, {2, 3}}).elements();
+    std::iota(elements.begin(), elements.end(), 1);
+    REQUIRE(values == std::vector<int>{
+        0, 0, 0, 0,
+        0, 1, 2, 3,
+        0, 4, 5, 6,
+        0, 0, 0, 0});
+
+    std::ranges::sort(elements, std::greater<>());
+    REQUIRE(values == std::vector<int>{
+        0, 0, 0, 0,
+        0, 6, 5, 4,
+        0, 3, 2, 1,
+        0, 0, 0, 0});
+}
+
+TEST_CASE("MutableArrayView2D subarray of subarray")
+{
+    std::vector<int> values(20);
+    Chorasmia::MutableArrayView2D grid(values.data(), {4, 5});
+    auto sub = grid.subarray({{1, 1}, {3, 4}}).subarray({{1, 1}, {2, 2}});
+    REQUIRE(sub.row_gap() == 3);
+    sub[{0, 0}] = 1;
+    sub[{1, 1}] = 2;
+    REQUIRE(values[12] == 1);
+    REQUIRE(values[18] == 2);
+}
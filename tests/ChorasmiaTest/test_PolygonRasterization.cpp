@@ -0,0 +1,131 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/PolygonRasterization.hpp>
+#include <Chorasmia/Array2D.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Test fill_polygon with a rectangle")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({4, 5});
+    fill_polygon(a.mut(), {{{1, 1}, {1, 4}, {3, 4}, {3, 1}}}, 7);
+    Array2D<int> expected({
+                              0, 0, 0, 0, 0,
+                              0, 7, 7, 7, 0,
+                              0, 7, 7, 7, 0,
+                              0, 0, 0, 0, 0
+                          }, {4, 5});
+    REQUIRE(a == expected);
+}
+
+TEST_CASE("Test fill_polygon with a triangle")
+{
+    using namespace Chorasmia;
+    Array2D<int> a({4, 7});
+    fill_polygon(a.mut(), {{{0, 0}, {4, 0}, {4, 7}}}, 1);
+    Array2D<int> expected({
+                              1, 0, 0, 0, 0, 0, 0,
+                              1, 1, 1, 0, 0, 0, 0,
+                              1, 1, 1, 1, 0, 0, 0,
+                              1, 1, 1, 1, 1, 1, 0
+                          }, {4, 7});
+    REQUIRE(a == expected);
+}
+
+TEST_CASE("Test fill_polygon with a hole")
+{
+    using namespace Chorasmia;
+    const Polygon polygon = {
+        {{0, 0}, {0, 5}, {5, 5}, {5, 0}},
+        {{1, 1}, {4, 1}, {4, 4}, {1, 4}}
+    };
+    Array2D<int> expected({
+                              1, 1, 1, 1, 1,
+                              1, 0, 0, 0, 1,
+                              1, 0, 0, 0, 1,
+                              1, 0, 0, 0, 1,
+                              1, 1, 1, 1, 1
+                          }, {5, 5});
+
+    Array2D<int> a({5, 5});
+    fill_polygon(a.mut(), polygon, 1, FillRule::EVEN_ODD);
+    REQUIRE(a == expected);
+
+    Array2D<int> b({5, 5});
+    fill_polygon(b.mut(), polygon, 1, FillRule::NON_ZERO);
+    REQUIRE(b == expected);
+}
+
+TEST_CASE("Test fill rules on overlapping rings")
+{
+    using namespace Chorasmia;
+    // Two rings with the same orientation, the second inside the first.
+    const Polygon polygon = {
+        {{0, 0}, {0, 4}, {4, 4}, {4, 0}},
+        {{1, 1}, {1, 3}, {3, 3}, {3, 1}}
+    };
+
+    Array2D<int> a({4, 4});
+    fill_polygon(a.mut(), polygon, 1, FillRule::EVEN_ODD);
+    REQUIRE(a[{1, 1}] == 0);
+    REQUIRE(a[{0, 0}] == 1);
+
+    Array2D<int> b({4, 4});
+    fill_polygon(b.mut(), polygon, 1, FillRule::NON_ZERO);
+    REQUIRE(b[{1, 1}] == 1);
+    REQUIRE(b[{0, 0}] == 1);
+}
+
+TEST_CASE("Test fill_polygons with clipping and overlaps")
+{
+    using namespace Chorasmia;
+    const std::vector<Polygon> polygons = {
+        {{{-10, -10}, {-10, 2}, {2, 2}, {2, -10}}},
+        {{{1, 1}, {1, 100}, {3, 100}, {3, 1}}}
+    };
+    const std::vector<int> values = {1, 2};
+
+    Array2D<int> a({4, 4});
+    fill_polygons(a.mut(), polygons, values);
+    Array2D<int> expected({
+                              1, 1, 0, 0,
+                              1, 2, 2, 2,
+                              0, 2, 2, 2,
+                              0, 0, 0, 0
+                          }, {4, 4});
+    REQUIRE(a == expected);
+
+    Array2D<int> b({4, 4});
+    fill_polygons(b.mut(), polygons, values, FillRule::EVEN_ODD,
+                  Extent2D<size_t>({1, 0}, {1, 3}));
+    Array2D<int> expected_clipped({
+                                      0, 0, 0, 0,
+                                      1, 2, 2, 0,
+                                      0, 0, 0, 0,
+                                      0, 0, 0, 0
+                                  }, {4, 4});
+    REQUIRE(b == expected_clipped);
+}
+
+TEST_CASE("Test rasterize_polygons with a blend functor")
+{
+    using namespace Chorasmia;
+    const std::vector<Polygon> polygons = {
+        {{{0, 0}, {0, 3}, {2, 3}, {2, 0}}},
+        {{{1, 1}, {1, 4}, {3, 4}, {3, 1}}}
+    };
+    Array2D<int> a({3, 4});
+    rasterize_polygons(a.mut(), polygons,
+                       [](int& cell, size_t i) {cell += int(i) + 1;});
+    Array2D<int> expected({
+                              1, 1, 1, 0,
+                              1, 3, 3, 2,
+                              0, 2, 2, 2
+                          }, {3, 4});
+    REQUIRE(a == expected);
+}
@@ -6,6 +6,13 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include <Chorasmia/RingBuffer.hpp>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("RingBuffer basics")
@@ -102,3 +109,372 @@ TEST_CASE("Iterator arithmetic")
         REQUIRE(it == buffer.begin());
     }
 }
+
+TEST_CASE("RingBuffer storage is rounded up to a power of two")
+{
+    STATIC_REQUIRE(sizeof(Chorasmia::RingBuffer<int, 8>)
+                   == 8 * sizeof(int) + 2 * sizeof(size_t));
+    STATIC_REQUIRE(sizeof(Chorasmia::RingBuffer<int, 1025>)
+                   == 2048 * sizeof(int) + 2 * sizeof(size_t));
+    REQUIRE(Chorasmia::RingBuffer<int, 1025>().capacity() == 1025);
+}
+
+TEST_CASE("RingBuffer wraps around many times")
+{
+    Chorasmia::RingBuffer<int, 5> buffer;
+    for (int i = 0; i < 1000; ++i)
+        buffer.push_back(i);
+    REQUIRE(buffer.size() == 5);
+    REQUIRE(buffer.capacity() == 5);
+    REQUIRE(buffer.front() == 995);
+    REQUIRE(buffer.back() == 999);
+    REQUIRE(std::vector<int>(buffer.begin(), buffer.end())
+            == std::vector<int>{995, 996, 997, 998, 999});
+    buffer.pop_back();
+    REQUIRE(buffer.back() == 998);
+    REQUIRE(*(buffer.end() - 4) == 995);
+}
+
+TEST_CASE("DynamicRingBuffer basics")
+{
+    Chorasmia::DynamicRingBuffer<int> buffer(3);
+    REQUIRE(buffer.capacity() == 3);
+    REQUIRE(buffer.empty());
+    for (int i = 1; i <= 5; ++i)
+        buffer.push_back(i);
+    REQUIRE(buffer.size() == 3);
+    REQUIRE(buffer[0] == 3);
+    REQUIRE(buffer[1] == 4);
+    REQUIRE(buffer[2] == 5);
+
+    auto copy = buffer;
+    copy.push_back(6);
+    REQUIRE(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{4, 5, 6});
+    REQUIRE(std::vector<int>(buffer.begin(), buffer.end()) == std::vector<int>{3, 4, 5});
+
+    auto moved = std::move(copy);
+    REQUIRE(moved.back() == 6);
+    REQUIRE(copy.empty());
+
+    buffer.clear();
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.begin() == buffer.end());
+}
+
+TEST_CASE("DynamicRingBuffer without capacity")
+{
+    Chorasmia::DynamicRingBuffer<int> buffer;
+    buffer.push_back(1);
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.capacity() == 0);
+}
+
+TEST_CASE("RingBuffer bulk push_back, pop_front and as_spans")
+{
+    Chorasmia::RingBuffer<int, 8> buffer;
+    std::vector<int> values{1, 2, 3, 4, 5, 6};
+    buffer.push_back(std::span<const int>(values));
+    REQUIRE(buffer.size() == 6);
+    buffer.pop_front(4);
+    REQUIRE(buffer.size() == 2);
+    REQUIRE(buffer.front() == 5);
+
+    std::vector<int> more{7, 8, 9, 10, 11};
+    buffer.push_back(std::span<const int>(more));
+    REQUIRE(buffer.size() == 7);
+
+    auto [first, second] = buffer.as_spans();
+    REQUIRE(std::vector<int>(first.begin(), first.end()) == std::vector<int>{5, 6, 7, 8});
+    REQUIRE(std::vector<int>(second.begin(), second.end()) == std::vector<int>{9, 10, 11});
+
+    std::vector<int> out(10);
+    REQUIRE(buffer.copy_out(out) == 7);
+    out.resize(7);
+    REQUIRE(out == std::vector<int>{5, 6, 7, 8, 9, 10, 11});
+
+    std::vector<int> small(3);
+    REQUIRE(buffer.copy_out(small) == 3);
+    REQUIRE(small == std::vector<int>{5, 6, 7});
+
+    buffer.pop_front(100);
+    REQUIRE(buffer.empty());
+}
+
+TEST_CASE("RingBuffer bulk push_back overwrites oldest values")
+{
+    Chorasmia::DynamicRingBuffer<int> buffer(5);
+    buffer.push_back(100);
+    buffer.push_back(101);
+    std::vector<int> values{1, 2, 3, 4};
+    buffer.push_back(std::span<const int>(values));
+    REQUIRE(std::vector<int>(buffer.begin(), buffer.end())
+            == std::vector<int>{101, 1, 2, 3, 4});
+
+    std::vector<int> many(12);
+    std::iota(many.begin(), many.end(), 0);
+    buffer.push_back(std::span<const int>(many));
+    REQUIRE(std::vector<int>(buffer.begin(), buffer.end())
+            == std::vector<int>{7, 8, 9, 10, 11});
+
+    auto [first, second] = buffer.as_spans();
+    REQUIRE(first.size() + second.size() == 5);
+    for (auto& v : first)
+        v *= 10;
+    REQUIRE(buffer.front() == 70);
+}
+
+TEST_CASE("RingBuffer bulk push_back of its own values")
+{
+    Chorasmia::RingBuffer<std::string, 4> buffer;
+    for (int i = 0; i < 4; ++i)
+        buffer.push_back(std::string(20, char('a' + i)));
+
+    // All the values are in the first span, and the oldest three are
+    // removed to make room for them.
+    const auto values = buffer.as_spans().first.first(3);
+    buffer.push_back(values);
+    REQUIRE(std::vector<std::string>(buffer.begin(), buffer.end())
+            == std::vector<std::string>{std::string(20, 'd'), std::string(20, 'a'),
+                                        std::string(20, 'b'), std::string(20, 'c')});
+}
+
+namespace
+{
+    struct Counted
+    {
+        explicit Counted(int value) : value(value) {++live;}
+
+        Counted(const Counted& other) : value(other.value) {++live;}
+
+        ~Counted() {--live;}
+
+        Counted& operator=(const Counted&) = default;
+
+        int value;
+        static inline int live = 0;
+    };
+}
+
+TEST_CASE("RingBuffer with move-only values")
+{
+    Chorasmia::RingBuffer<std::unique_ptr<int>, 3> buffer;
+    for (int i = 1; i <= 4; ++i)
+        buffer.push_back(std::make_unique<int>(i));
+    REQUIRE(buffer.size() == 3);
+    REQUIRE(*buffer.front() == 2);
+    REQUIRE(*buffer.emplace_back(new int(5)) == 5);
+    REQUIRE(*buffer.front() == 3);
+
+    auto moved = std::move(buffer);
+    REQUIRE(buffer.empty());
+    REQUIRE(moved.size() == 3);
+    REQUIRE(*moved.back() == 5);
+
+    Chorasmia::DynamicRingBuffer<std::unique_ptr<int>> dynamic(2);
+    dynamic.emplace_back(std::make_unique<int>(7));
+    auto moved_dynamic = std::move(dynamic);
+    REQUIRE(dynamic.empty());
+    REQUIRE(*moved_dynamic.front() == 7);
+}
+
+TEST_CASE("RingBuffer doesn't construct unused values")
+{
+    REQUIRE(Counted::live == 0);
+    {
+        Chorasmia::RingBuffer<Counted, 4> buffer;
+        REQUIRE(Counted::live == 0);
+
+        for (int i = 0; i < 6; ++i)
+            buffer.emplace_back(i);
+        REQUIRE(Counted::live == 4);
+        REQUIRE(buffer.front().value == 2);
+
+        buffer.pop_back();
+        buffer.pop_front();
+        REQUIRE(Counted::live == 2);
+
+        auto copy = buffer;
+        REQUIRE(Counted::live == 4);
+        REQUIRE(copy.front().value == 3);
+
+        copy.clear();
+        REQUIRE(Counted::live == 2);
+
+        std::vector<Counted> values{Counted(10), Counted(11), Counted(12)};
+        buffer.push_back(std::span<const Counted>(values));
+        REQUIRE(Counted::live == 4 + 3);
+        REQUIRE(buffer.front().value == 4);
+    }
+    REQUIRE(Counted::live == 0);
+
+    {
+        Chorasmia::DynamicRingBuffer<Counted> buffer(3);
+        for (int i = 0; i < 5; ++i)
+            buffer.emplace_back(i);
+        REQUIRE(Counted::live == 3);
+        auto copy = buffer;
+        REQUIRE(Counted::live == 6);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("DynamicRingBuffer emplace_back without capacity")
+{
+    Chorasmia::DynamicRingBuffer<std::string> buffer;
+    REQUIRE_THROWS(buffer.emplace_back("a"));
+}
+
+TEST_CASE("RingBuffer push_back of its own front when full")
+{
+    // Capacity 4 uses all the slots in the storage, capacity 3 leaves
+    // one slot unused.
+    Chorasmia::RingBuffer<std::string, 4> buffer;
+    Chorasmia::DynamicRingBuffer<std::string> dynamic(3);
+    for (int i = 0; i < 4; ++i)
+    {
+        buffer.push_back(std::string(20, char('a' + i)));
+        dynamic.push_back(std::string(20, char('a' + i)));
+    }
+
+    buffer.push_back(buffer.front());
+    REQUIRE(buffer.size() == 4);
+    REQUIRE(buffer.back() == std::string(20, 'a'));
+    REQUIRE(buffer.front() == std::string(20, 'b'));
+
+    dynamic.push_back(dynamic.front());
+    REQUIRE(dynamic.size() == 3);
+    REQUIRE(dynamic.back() == std::string(20, 'b'));
+    REQUIRE(dynamic.front() == std::string(20, 'c'));
+
+    dynamic.emplace_back(dynamic[0], 1, 5);
+    REQUIRE(dynamic.back() == std::string(5, 'c'));
+}
+
+namespace
+{
+    struct ThrowingValue
+    {
+        explicit ThrowingValue(int value) : value(value)
+        {
+            if (value < 0)
+                throw std::runtime_error("Negative value.");
+        }
+
+        int value;
+    };
+}
+
+TEST_CASE("RingBuffer is unchanged when emplace_back throws")
+{
+    Chorasmia::RingBuffer<ThrowingValue, 4> buffer;
+    Chorasmia::RingBuffer<ThrowingValue, 3> spare_buffer;
+    for (int i = 0; i < 4; ++i)
+    {
+        buffer.emplace_back(i);
+        spare_buffer.emplace_back(i);
+    }
+
+    REQUIRE_THROWS(buffer.emplace_back(-1));
+    REQUIRE(buffer.size() == 4);
+    REQUIRE(buffer.front().value == 0);
+    REQUIRE(buffer.back().value == 3);
+
+    REQUIRE_THROWS(spare_buffer.emplace_back(-1));
+    REQUIRE(spare_buffer.size() == 3);
+    REQUIRE(spare_buffer.front().value == 1);
+    REQUIRE(spare_buffer.back().value == 3);
+}
+
+static_assert(std::random_access_iterator<Chorasmia::RingBuffer<int, 4>::iterator>);
+static_assert(std::random_access_iterator<Chorasmia::RingBuffer<int, 4>::const_iterator>);
+
+TEST_CASE("RingBuffer random access iterators")
+{
+    Chorasmia::RingBuffer<int, 6> buffer;
+    for (int i : {50, 10, 40, 20, 60, 30, 0})
+        buffer.push_back(i);
+    REQUIRE(buffer.front() == 10);
+
+    std::sort(buffer.begin(), buffer.end());
+    REQUIRE(std::vector<int>(buffer.begin(), buffer.end())
+            == std::vector<int>{0, 10, 20, 30, 40, 60});
+
+    const auto& cbuffer = buffer;
+    auto it = std::lower_bound(cbuffer.begin(), cbuffer.end(), 25);
+    REQUIRE(it - cbuffer.begin() == 3);
+    REQUIRE(*it == 30);
+    REQUIRE(it[1] == 40);
+    REQUIRE(cbuffer.begin() < it);
+    REQUIRE(it >= cbuffer.begin() + 3);
+    REQUIRE(cbuffer.end() - cbuffer.begin() == 6);
+
+    Chorasmia::RingBuffer<int, 6>::const_iterator cit = buffer.begin();
+    REQUIRE(cit == cbuffer.begin());
+
+    *buffer.begin() = -1;
+    REQUIRE(buffer.front() == -1);
+}
+
+TEST_CASE("RingBuffer push_front and emplace_front")
+{
+    Chorasmia::RingBuffer<std::string, 3> buffer;
+    buffer.push_front("b");
+    buffer.push_back("c");
+    REQUIRE(buffer.emplace_front(1, 'a') == "a");
+    REQUIRE(std::vector<std::string>(buffer.begin(), buffer.end())
+            == std::vector<std::string>{"a", "b", "c"});
+
+    // When the buffer is full, push_front replaces the newest value.
+    buffer.push_front("z");
+    REQUIRE(std::vector<std::string>(buffer.begin(), buffer.end())
+            == std::vector<std::string>{"z", "a", "b"});
+
+    buffer.pop_front();
+    REQUIRE(buffer.front() == "a");
+    REQUIRE(buffer.end() - buffer.begin() == 2);
+    REQUIRE(buffer.begin() < buffer.end());
+
+    auto [first, second] = buffer.as_spans();
+    REQUIRE(first.size() + second.size() == 2);
+}
+
+TEST_CASE("RingBuffer push_front of its own back when full")
+{
+    Chorasmia::RingBuffer<std::string, 4> buffer;
+    Chorasmia::DynamicRingBuffer<std::string> dynamic(3);
+    for (int i = 0; i < 4; ++i)
+    {
+        buffer.push_back(std::string(20, char('a' + i)));
+        dynamic.push_back(std::string(20, char('a' + i)));
+    }
+
+    buffer.push_front(buffer.back());
+    REQUIRE(buffer.size() == 4);
+    REQUIRE(buffer.front() == std::string(20, 'd'));
+    REQUIRE(buffer.back() == std::string(20, 'c'));
+
+    dynamic.push_front(dynamic.back());
+    REQUIRE(dynamic.size() == 3);
+    REQUIRE(dynamic.front() == std::string(20, 'd'));
+    REQUIRE(dynamic.back() == std::string(20, 'c'));
+
+    Chorasmia::RingBuffer<ThrowingValue, 2> throwing;
+    throwing.emplace_back(1);
+    throwing.emplace_back(2);
+    REQUIRE_THROWS(throwing.emplace_front(-1));
+    REQUIRE(throwing.front().value == 1);
+    REQUIRE(throwing.back().value == 2);
+}
+
+TEST_CASE("DynamicRingBuffer as a sliding window of timestamps")
+{
+    Chorasmia::DynamicRingBuffer<int> window(5);
+    for (int t = 0; t < 100; t += 3)
+        window.push_back(t);
+    window.push_front(-1);
+    REQUIRE(window.front() == -1);
+    REQUIRE(window.back() == 96);
+    auto it = std::upper_bound(window.begin(), window.end(), 90);
+    REQUIRE(*it == 93);
+    REQUIRE(std::distance(window.begin(), it) == 3);
+}
@@ -0,0 +1,145 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/SegmentedIntervalMap.hpp>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    template <typename Key, typename Value, size_t LeafSize>
+    std::vector<std::pair<Key, Value>>
+    to_vector(const Chorasmia::SegmentedIntervalMap<Key, Value, LeafSize>& map)
+    {
+        return {map.begin(), map.end()};
+    }
+
+    template <typename Key, typename Value>
+    std::vector<std::pair<Key, Value>>
+    to_vector(const Chorasmia::IntervalMap<Key, Value>& map)
+    {
+        return {map.begin(), map.end()};
+    }
+}
+
+TEST_CASE("SegmentedIntervalMap point and range insert")
+{
+    using P = std::pair<double, uint32_t>;
+    Chorasmia::SegmentedIntervalMap<double, uint32_t, 4> map;
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.find(100)->second == 0);
+
+    map.insert(0, 1);
+    map.insert(200, 2);
+    map.insert(50, 3);
+    REQUIRE(map.size() == 5);
+    REQUIRE(map.find(100)->second == 3);
+    REQUIRE(map.find(200)->second == 2);
+    REQUIRE(map.find(-1)->second == 0);
+
+    map.insert(10, 20, 4);
+    REQUIRE(map.size() == 7);
+    REQUIRE(map.find(15)->second == 4);
+    REQUIRE(map.find(20)->second == 1);
+
+    map.insert(5, 150, 5);
+    auto values = to_vector(map);
+    REQUIRE(values.size() == 6);
+    REQUIRE(values[1] == P{0, 1});
+    REQUIRE(values[2] == P{5, 5});
+    REQUIRE(values[3] == P{150, 3});
+    REQUIRE(values[4] == P{200, 2});
+}
+
+TEST_CASE("SegmentedIntervalMap iterators")
+{
+    Chorasmia::SegmentedIntervalMap<int, int, 4> map;
+    for (int i = 1; i <= 20; ++i)
+        map.insert(i * 10, i);
+    REQUIRE(map.leaf_count() > 1);
+    REQUIRE(std::distance(map.begin(), map.end()) == 22);
+
+    auto it = map.find(55);
+    REQUIRE(it->first == 50);
+    ++it;
+    REQUIRE(it->first == 60);
+    --it;
+    --it;
+    REQUIRE(it->first == 40);
+}
+
+TEST_CASE("SegmentedIntervalMap matches IntervalMap")
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> key_dist(-1000, 1000);
+    std::uniform_int_distribution<int> op_dist(0, 2);
+
+    Chorasmia::IntervalMap<int, int> expected(-1);
+    Chorasmia::SegmentedIntervalMap<int, int, 8> map(-1);
+    for (int i = 0; i < 3000; ++i)
+    {
+        const auto a = key_dist(rng);
+        if (op_dist(rng) == 0)
+        {
+            expected.insert(a, i);
+            map.insert(a, i);
+        }
+        else
+        {
+            const auto b = a + key_dist(rng) / 10;
+            expected.insert(a, b, i);
+            map.insert(a, b, i);
+        }
+
+        REQUIRE(map.size() == expected.size());
+        if (i % 100 == 0)
+            REQUIRE(to_vector(map) == to_vector(expected));
+        const auto key = key_dist(rng);
+        REQUIRE(*map.find(key) == *expected.find(key));
+    }
+    REQUIRE(to_vector(map) == to_vector(expected));
+}
+
+TEST_CASE("SegmentedIntervalMap with floating point keys")
+{
+    Chorasmia::IntervalMap<double, int> expected;
+    Chorasmia::SegmentedIntervalMap<double, int, 16> map;
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<double> dist(0, 100);
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto a = dist(rng);
+        const auto b = a + dist(rng) / 20;
+        expected.insert(a, b, i);
+        map.insert(a, b, i);
+        // Within the margin of an existing boundary.
+        expected.insert(a + 1e-15, i + 1);
+        map.insert(a + 1e-15, i + 1);
+    }
+    REQUIRE(to_vector(map) == to_vector(expected));
+}
+
+TEST_CASE("SegmentedIntervalMap copies share unmodified leaves")
+{
+    Chorasmia::SegmentedIntervalMap<int, int, 4> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i * 10, i * 10 + 5, i);
+    const auto expected = to_vector(map);
+
+    auto copy = map;
+    copy.insert(500, 505, -1);
+    copy.insert(0, 1000, -2);
+    REQUIRE(to_vector(map) == expected);
+    REQUIRE(copy.size() == 4);
+    REQUIRE(copy.find(500)->second == -2);
+
+    copy = map;
+    map.insert(0, 1000, -3);
+    REQUIRE(to_vector(copy) == expected);
+    REQUIRE(map.find(500)->second == -3);
+}
@@ -0,0 +1,132 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/SharedArray2D.hpp>
+#include <numeric>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    Chorasmia::Array2D<int> make_sequence(Chorasmia::Size2D<size_t> size)
+    {
+        Chorasmia::Array2D<int> result(size);
+        std::iota(result.data(), result.data() + result.value_count(), 0);
+        return result;
+    }
+}
+
+TEST_CASE("SharedArray2D from ArrayView2D")
+{
+    using namespace Chorasmia;
+    auto values = make_sequence({5, 7});
+    SharedArray2D<int> a(values.view(), {2, 3});
+    REQUIRE(a.dimensions() == Size2D<size_t>(5, 7));
+    REQUIRE(a.tile_counts() == Size2D<size_t>(3, 3));
+    REQUIRE(a.tile({2, 2}).dimensions() == Size2D<size_t>(1, 1));
+    REQUIRE(a[{4, 6}] == 34);
+    REQUIRE(a[{3, 2}] == 23);
+    REQUIRE(a.to_array() == values);
+}
+
+TEST_CASE("SharedArray2D from a view with row gaps")
+{
+    using namespace Chorasmia;
+    auto values = make_sequence({5, 7});
+    auto sub = values.view().subarray({{1, 2}, {3, 4}});
+    SharedArray2D<int> a(sub, {2, 2});
+    REQUIRE(a[{0, 0}] == 9);
+    REQUIRE(a[{2, 3}] == 26);
+}
+
+TEST_CASE("SharedArray2D copies only modified tiles")
+{
+    using namespace Chorasmia;
+    SharedArray2D<int> a(make_sequence({8, 8}).view(), {4, 4});
+    auto snapshot = a;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        for (size_t j = 0; j < 2; ++j)
+            REQUIRE(a.shares_tile(snapshot, {i, j}));
+    }
+
+    a.set({5, 1}, -1);
+    REQUIRE(a[{5, 1}] == -1);
+    REQUIRE(snapshot[{5, 1}] == 41);
+    REQUIRE(a.shares_tile(snapshot, {0, 0}));
+    REQUIRE(a.shares_tile(snapshot, {0, 1}));
+    REQUIRE_FALSE(a.shares_tile(snapshot, {1, 0}));
+    REQUIRE(a.shares_tile(snapshot, {1, 1}));
+    REQUIRE(a != snapshot);
+
+    // The tile is no longer shared and isn't copied again.
+    const auto* tile_data = a.tile({1, 0}).data();
+    a.set({4, 0}, -2);
+    REQUIRE(a.tile({1, 0}).data() == tile_data);
+    REQUIRE(snapshot[{4, 0}] == 32);
+}
+
+TEST_CASE("SharedArray2D write")
+{
+    using namespace Chorasmia;
+    SharedArray2D<int> a({6, 6}, 0, {4, 4});
+    REQUIRE(a.shares_tile(a, {0, 0}));
+    auto snapshot = a;
+
+    Array2D<int> values({2, 2});
+    values.fill(7);
+    a.write({2, 2}, values.view());
+    a.write({5, 5}, values.view());
+
+    auto expected = Array2D<int>({6, 6});
+    expected.fill(0);
+    expected[{2, 2}] = 7;
+    expected[{2, 3}] = 7;
+    expected[{3, 2}] = 7;
+    expected[{3, 3}] = 7;
+    expected[{5, 5}] = 7;
+    REQUIRE(a.to_array() == expected);
+    REQUIRE(snapshot.to_array() == Array2D<int>(std::vector<int>(36), {6, 6}));
+}
+
+TEST_CASE("SharedArray2D mutable_tile")
+{
+    using namespace Chorasmia;
+    SharedArray2D<int> a({4, 4}, 1, {2, 2});
+    auto snapshot = a;
+    auto tile = a.mutable_tile({1, 0});
+    tile[{0, 1}] = 5;
+    REQUIRE(a[{2, 1}] == 5);
+    REQUIRE(snapshot[{2, 1}] == 1);
+    REQUIRE_THROWS_AS(a.mutable_tile({2, 0}), ChorasmiaException);
+}
+
+TEST_CASE("SharedArray2D snapshots on reader threads")
+{
+    using namespace Chorasmia;
+    SharedArray2D<int> a({64, 64}, 0, {16, 16});
+    std::vector<long> sums(8);
+    {
+        std::vector<std::jthread> readers;
+        for (int k = 0; k < 8; ++k)
+        {
+            readers.emplace_back([snapshot = a, &sum = sums[k]]
+            {
+                for (size_t i = 0; i < snapshot.row_count(); ++i)
+                {
+                    for (size_t j = 0; j < snapshot.col_count(); ++j)
+                        sum += snapshot[{i, j}];
+                }
+            });
+            for (size_t j = 0; j < 64; ++j)
+                a.set({size_t(k * 7), j}, 1);
+        }
+    }
+
+    for (size_t k = 0; k < sums.size(); ++k)
+        REQUIRE(sums[k] == long(k) * 64);
+}
@@ -0,0 +1,191 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/SharedMemoryRingBuffer.hpp>
+
+#ifdef __linux__
+
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    struct Record
+    {
+        uint64_t id;
+        double value;
+    };
+
+    std::string get_segment_name(const char* suffix)
+    {
+        return "/chorasmia_test_" + std::to_string(getpid()) + "_" + suffix;
+    }
+
+    // Removes the segment name when the test ends, also when a
+    // REQUIRE fails.
+    struct SegmentNameGuard
+    {
+        explicit SegmentNameGuard(std::string name)
+            : name(std::move(name))
+        {}
+
+        ~SegmentNameGuard()
+        {
+            shm_unlink(name.c_str());
+        }
+
+        std::string name;
+    };
+}
+
+TEST_CASE("SharedMemoryRingBuffer in a single process")
+{
+    const auto name = get_segment_name("single");
+    SegmentNameGuard guard(name);
+    auto producer = Chorasmia::SharedMemoryRingBuffer<Record>::create(name, 5);
+    auto consumer = Chorasmia::SharedMemoryRingBuffer<Record>::open(name);
+    Chorasmia::SharedMemoryRingBuffer<Record>::unlink(name);
+
+    REQUIRE(producer.capacity() == 8);
+    REQUIRE(consumer.capacity() == 8);
+    REQUIRE(consumer.empty());
+
+    for (uint64_t i = 0; i < 8; ++i)
+        REQUIRE(producer.try_push({i, double(i) / 2}));
+    REQUIRE(!producer.try_push({8, 4.0}));
+    REQUIRE(consumer.size() == 8);
+
+    Record record = {};
+    REQUIRE(consumer.try_pop(record));
+    REQUIRE(record.id == 0);
+
+    std::vector<Record> records(10);
+    REQUIRE(consumer.try_pop(std::span<Record>(records)) == 7);
+    REQUIRE(records[6].id == 7);
+    REQUIRE(records[6].value == 3.5);
+    REQUIRE(!consumer.try_pop(record));
+
+    producer.push({10, 5.0});
+    producer.push({11, 5.5});
+    REQUIRE(consumer.pop().id == 10);
+    consumer.pop(record);
+    REQUIRE(record.id == 11);
+}
+
+TEST_CASE("SharedMemoryRingBuffer open checks the segment")
+{
+    const auto name = get_segment_name("checks");
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<Record>::open(name));
+
+    SegmentNameGuard guard(name);
+    auto buffer = Chorasmia::SharedMemoryRingBuffer<Record>::create(name, 4);
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<Record>::create(name, 4));
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<uint32_t>::open(name));
+    Chorasmia::SharedMemoryRingBuffer<Record>::unlink(name);
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<Record>::open(name));
+}
+
+TEST_CASE("SharedMemoryRingBuffer open rejects an invalid capacity")
+{
+    using Header = Chorasmia::Detail::SharedRingBufferHeader;
+    const auto name = get_segment_name("capacity");
+    SegmentNameGuard guard(name);
+    auto buffer = Chorasmia::SharedMemoryRingBuffer<Record>::create(name, 4);
+
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    REQUIRE(fd != -1);
+    void* memory = mmap(nullptr, sizeof(Header), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    close(fd);
+    REQUIRE(memory != MAP_FAILED);
+    auto& header = *static_cast<Header*>(memory);
+
+    header.capacity = 0;
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<Record>::open(name));
+    header.capacity = 3;
+    REQUIRE_THROWS(Chorasmia::SharedMemoryRingBuffer<Record>::open(name));
+    header.capacity = 4;
+    REQUIRE(Chorasmia::SharedMemoryRingBuffer<Record>::open(name).capacity() == 4);
+    munmap(memory, sizeof(Header));
+}
+
+TEST_CASE("SharedMemoryRingBuffer between two processes")
+{
+    constexpr uint64_t COUNT = 100'000;
+    const auto name = get_segment_name("fork");
+    SegmentNameGuard guard(name);
+    auto consumer = Chorasmia::SharedMemoryRingBuffer<Record>::create(name, 64);
+
+    const pid_t pid = fork();
+    REQUIRE(pid != -1);
+    if (pid == 0)
+    {
+        int status = 0;
+        try
+        {
+            auto producer = Chorasmia::SharedMemoryRingBuffer<Record>::open(name);
+            for (uint64_t i = 0; i < COUNT; ++i)
+                producer.push({i, double(i) * 2});
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        _exit(status);
+    }
+
+    // Don't block in pop, the test would hang if the child fails.
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::seconds(60);
+    uint64_t received = 0;
+    uint64_t mismatches = 0;
+    int status = -1;
+    bool child_exited = false;
+    while (received < COUNT && std::chrono::steady_clock::now() < deadline)
+    {
+        Record record = {};
+        if (consumer.try_pop(record))
+        {
+            if (record.id != received || record.value != double(received) * 2)
+                ++mismatches;
+            ++received;
+        }
+        else if (child_exited)
+        {
+            // The queue was still empty after the child exited.
+            break;
+        }
+        else
+        {
+            child_exited = waitpid(pid, &status, WNOHANG) == pid;
+            std::this_thread::yield();
+        }
+    }
+
+    if (!child_exited)
+    {
+        if (received != COUNT)
+            kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+    }
+
+    REQUIRE(received == COUNT);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(mismatches == 0);
+    REQUIRE(consumer.empty());
+}
+
+#endif
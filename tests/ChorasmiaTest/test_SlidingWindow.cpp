@@ -0,0 +1,112 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/SlidingWindow.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("SlidingWindow with integers")
+{
+    Chorasmia::SlidingWindow<int, 3, Chorasmia::WindowSum, Chorasmia::WindowMean,
+                             Chorasmia::WindowMin, Chorasmia::WindowMax> window;
+    REQUIRE(window.empty());
+    REQUIRE(window.sum() == 0);
+    REQUIRE(window.mean() == 0);
+
+    window.push(5);
+    REQUIRE(window.min() == 5);
+    REQUIRE(window.max() == 5);
+
+    window.push(2);
+    window.push(7);
+    REQUIRE(window.sum() == 14);
+    REQUIRE(window.min() == 2);
+    REQUIRE(window.max() == 7);
+
+    window.push(4);
+    REQUIRE(window.size() == 3);
+    REQUIRE(window.sum() == 13);
+    REQUIRE(window.min() == 2);
+
+    window.push(6);
+    REQUIRE(window.sum() == 17);
+    REQUIRE(window.min() == 4);
+    REQUIRE(window.max() == 7);
+    REQUIRE_THAT(window.mean(), WithinAbs(17.0 / 3, 1e-12));
+
+    window.push(1);
+    REQUIRE(window.min() == 1);
+    REQUIRE(window.max() == 6);
+
+    window.clear();
+    REQUIRE(window.empty());
+    REQUIRE(window.sum() == 0);
+    window.push(9);
+    REQUIRE(window.min() == 9);
+    REQUIRE(window.max() == 9);
+}
+
+TEST_CASE("SlidingWindow with variance")
+{
+    Chorasmia::SlidingWindow<double, 4, Chorasmia::WindowVariance> window;
+    REQUIRE(window.variance() == 0);
+    for (double v : {1.0, 2.0, 3.0, 4.0})
+        window.push(v);
+    REQUIRE_THAT(window.mean(), WithinAbs(2.5, 1e-12));
+    REQUIRE_THAT(window.variance(), WithinAbs(1.25, 1e-12));
+    REQUIRE_THAT(window.sample_variance(), WithinAbs(5.0 / 3, 1e-12));
+
+    window.push(10.0);
+    REQUIRE_THAT(window.mean(), WithinAbs(4.75, 1e-12));
+    REQUIRE_THAT(window.variance(), WithinAbs(9.6875, 1e-12));
+}
+
+TEST_CASE("SlidingWindow matches recomputing the aggregates")
+{
+    Chorasmia::SlidingWindow<double, 16, Chorasmia::WindowSum,
+                             Chorasmia::WindowVariance, Chorasmia::WindowMin,
+                             Chorasmia::WindowMax> window;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-100, 100);
+    std::vector<double> all;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto value = dist(rng);
+        all.push_back(value);
+        window.push(value);
+
+        const auto first = all.end() - std::min<ptrdiff_t>(ptrdiff_t(all.size()), 16);
+        const std::vector<double> expected(first, all.end());
+        double sum = 0;
+        for (auto v : expected)
+            sum += v;
+        const auto mean = sum / double(expected.size());
+        double m2 = 0;
+        for (auto v : expected)
+            m2 += (v - mean) * (v - mean);
+
+        REQUIRE(window.size() == expected.size());
+        REQUIRE_THAT(window.sum(), WithinAbs(sum, 1e-9));
+        REQUIRE_THAT(window.mean(), WithinAbs(mean, 1e-9));
+        REQUIRE_THAT(window.variance(), WithinAbs(m2 / double(expected.size()), 1e-7));
+        REQUIRE(window.min() == *std::min_element(expected.begin(), expected.end()));
+        REQUIRE(window.max() == *std::max_element(expected.begin(), expected.end()));
+    }
+}
+
+TEST_CASE("SlidingWindow without aggregates has no overhead")
+{
+    using Plain = Chorasmia::SlidingWindow<int, 8>;
+    using WithMin = Chorasmia::SlidingWindow<int, 8, Chorasmia::WindowMin>;
+    STATIC_REQUIRE(sizeof(Plain) == sizeof(Chorasmia::RingBuffer<int, 8>) + sizeof(size_t));
+    STATIC_REQUIRE(sizeof(WithMin) > sizeof(Plain));
+}
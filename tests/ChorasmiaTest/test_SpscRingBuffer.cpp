@@ -0,0 +1,108 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Chorasmia/SpscRingBuffer.hpp>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("SpscRingBuffer push and pop")
+{
+    Chorasmia::SpscRingBuffer<int, 3> buffer;
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.try_push(1));
+    REQUIRE(buffer.try_push(2));
+    REQUIRE(buffer.try_push(3));
+    REQUIRE_FALSE(buffer.try_push(4));
+    REQUIRE(buffer.size() == 3);
+
+    int value = 0;
+    REQUIRE(buffer.try_pop(value));
+    REQUIRE(value == 1);
+    REQUIRE(buffer.try_push(4));
+    for (int expected = 2; expected <= 4; ++expected)
+    {
+        REQUIRE(buffer.try_pop(value));
+        REQUIRE(value == expected);
+    }
+    REQUIRE_FALSE(buffer.try_pop(value));
+}
+
+TEST_CASE("SpscRingBuffer batch push and pop")
+{
+    Chorasmia::SpscRingBuffer<int, 8> buffer;
+    std::vector<int> values(6);
+    std::iota(values.begin(), values.end(), 0);
+    REQUIRE(buffer.try_push(std::span<const int>(values)) == 6);
+
+    std::vector<int> popped(4);
+    REQUIRE(buffer.try_pop(std::span<int>(popped)) == 4);
+    REQUIRE(popped == std::vector<int>{0, 1, 2, 3});
+
+    // Wraps around the end of the buffer, and only 6 of 10 values fit.
+    std::vector<int> more(10);
+    std::iota(more.begin(), more.end(), 6);
+    REQUIRE(buffer.try_push(std::span<const int>(more)) == 6);
+    REQUIRE(buffer.size() == 8);
+
+    popped.resize(10);
+    REQUIRE(buffer.try_pop(std::span<int>(popped)) == 8);
+    popped.resize(8);
+    REQUIRE(popped == std::vector<int>{4, 5, 6, 7, 8, 9, 10, 11});
+    REQUIRE(buffer.try_pop(std::span<int>(popped)) == 0);
+}
+
+TEST_CASE("SpscRingBuffer with producer and consumer threads")
+{
+    constexpr size_t COUNT = 200'000;
+    Chorasmia::SpscRingBuffer<size_t, 1024> buffer;
+    std::vector<size_t> received;
+    received.reserve(COUNT);
+
+    {
+        std::jthread consumer([&]
+        {
+            size_t values[100];
+            while (received.size() < COUNT)
+            {
+                const auto n = buffer.try_pop(std::span<size_t>(values));
+                if (n == 0)
+                    std::this_thread::yield();
+                received.insert(received.end(), values, values + n);
+            }
+        });
+
+        size_t next = 0;
+        while (next < COUNT)
+        {
+            if (next % 3 == 0)
+            {
+                if (buffer.try_push(next))
+                    ++next;
+                else
+                    std::this_thread::yield();
+            }
+            else
+            {
+                size_t values[7];
+                const auto n = std::min<size_t>(7, COUNT - next);
+                std::iota(values, values + n, next);
+                const auto pushed = buffer.try_push(std::span<const size_t>(values, n));
+                if (pushed == 0)
+                    std::this_thread::yield();
+                next += pushed;
+            }
+        }
+    }
+
+    REQUIRE(received.size() == COUNT);
+    bool in_order = true;
+    for (size_t i = 0; i < COUNT; ++i)
+        in_order = in_order && received[i] == i;
+    REQUIRE(in_order);
+}